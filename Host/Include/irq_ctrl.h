@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 Validation (host build)
+ * Title:       Emulated interrupt controller interface
+ *
+ * Note: Subset of the CMSIS-Core(A) irq_ctrl.h interface. Interrupts are
+ *       emulated by the host kernel (os_host.c) using POSIX signals that
+ *       are delivered to the thread which is currently running.
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef IRQ_CTRL_H_
+#define IRQ_CTRL_H_
+
+#include <stdint.h>
+
+/* Number of emulated interrupt lines */
+#ifndef IRQ_HOST_NUM
+#define IRQ_HOST_NUM          8
+#endif
+
+/* Interrupt mode bit-masks */
+#define IRQ_MODE_TRIG_LEVEL   (0x00U)   ///< Trigger: level triggered interrupt
+#define IRQ_MODE_TRIG_EDGE    (0x01U)   ///< Trigger: edge triggered interrupt
+
+#define IRQ_MODE_ERROR        (0x80000000U) ///< Bit indicating mode value error
+
+/* Interrupt ID type */
+typedef int32_t IRQn_ID_t;
+
+/* Interrupt handler type */
+typedef void (*IRQHandler_t) (void);
+
+/* Interrupt management functions */
+int32_t      IRQ_Initialize   (void);
+int32_t      IRQ_SetHandler   (IRQn_ID_t irqn, IRQHandler_t handler);
+IRQHandler_t IRQ_GetHandler   (IRQn_ID_t irqn);
+int32_t      IRQ_Enable       (IRQn_ID_t irqn);
+int32_t      IRQ_Disable      (IRQn_ID_t irqn);
+uint32_t     IRQ_GetEnableState (IRQn_ID_t irqn);
+int32_t      IRQ_SetMode      (IRQn_ID_t irqn, uint32_t mode);
+uint32_t     IRQ_GetMode      (IRQn_ID_t irqn);
+int32_t      IRQ_SetPending   (IRQn_ID_t irqn);
+uint32_t     IRQ_GetPending   (IRQn_ID_t irqn);
+int32_t      IRQ_ClearPending (IRQn_ID_t irqn);
+
+#endif /* IRQ_CTRL_H_ */
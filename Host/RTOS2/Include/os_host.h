@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 Validation (host build)
+ * Title:       Host kernel definitions
+ *
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef OS_HOST_H_
+#define OS_HOST_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "cmsis_os2.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Configuration
+ *----------------------------------------------------------------------------*/
+
+/* Kernel tick frequency [Hz] */
+#ifndef OS_HOST_TICK_FREQ
+#define OS_HOST_TICK_FREQ             1000U
+#endif
+
+/* Clock driving the kernel tick
+   (CLOCK_PROCESS_CPUTIME_ID: tick advances only while the process executes,
+    which keeps tick based timing stable on a loaded host,
+    CLOCK_MONOTONIC: tick advances in wall clock time) */
+#ifndef OS_HOST_TICK_CLOCK
+#define OS_HOST_TICK_CLOCK            CLOCK_PROCESS_CPUTIME_ID
+#endif
+
+/* Kernel system timer frequency [Hz] (virtual clock derived from the tick) */
+#ifndef OS_HOST_SYSTIMER_FREQ
+#define OS_HOST_SYSTIMER_FREQ         100000000U
+#endif
+
+/* Round-robin thread switching (0: disabled, 1: enabled) */
+#ifndef OS_HOST_ROBIN_ENABLE
+#define OS_HOST_ROBIN_ENABLE          1
+#endif
+
+/* Round-robin time slice [ticks] */
+#ifndef OS_HOST_ROBIN_TIMEOUT
+#define OS_HOST_ROBIN_TIMEOUT         5U
+#endif
+
+/* Default thread stack size reported for threads created without stack size [bytes] */
+#ifndef OS_HOST_STACK_SIZE
+#define OS_HOST_STACK_SIZE            3072U
+#endif
+
+/* Stack size of the host (pthread) threads backing RTOS threads [bytes] */
+#ifndef OS_HOST_PTHREAD_STACK_SIZE
+#define OS_HOST_PTHREAD_STACK_SIZE    262144U
+#endif
+
+/* Timer thread priority */
+#ifndef OS_HOST_TIMER_THREAD_PRIO
+#define OS_HOST_TIMER_THREAD_PRIO     osPriorityHigh
+#endif
+
+/* Advance the kernel tick to the next timeout when all threads are blocked
+   (0: tick advances in real time only, 1: idle time is skipped) */
+#ifndef OS_HOST_IDLE_SKIP
+#define OS_HOST_IDLE_SKIP             1
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Kernel objects
+ *----------------------------------------------------------------------------*/
+
+/* Object identifiers */
+#define osHostIdInvalid               0x00U
+#define osHostIdThread                0xF1U
+#define osHostIdTimer                 0xF2U
+#define osHostIdEventFlags            0xF3U
+#define osHostIdMutex                 0xF5U
+#define osHostIdSemaphore             0xF6U
+#define osHostIdMemoryPool            0xF7U
+#define osHostIdMessageQueue          0xFAU
+
+/* Object flags */
+#define osHostFlagSystemObject        0x01U   /* Control block allocated by kernel */
+#define osHostFlagSystemMemory        0x02U   /* Data memory allocated by kernel   */
+
+/* Thread states (low nibble: osThreadState_t, high nibble: wait reason) */
+#define osHostThreadInactive          ((uint8_t)osThreadInactive)
+#define osHostThreadReady             ((uint8_t)osThreadReady)
+#define osHostThreadRunning           ((uint8_t)osThreadRunning)
+#define osHostThreadBlocked           ((uint8_t)osThreadBlocked)
+#define osHostThreadTerminated        ((uint8_t)osThreadTerminated)
+#define osHostThreadWaitingDelay      ((uint8_t)(osHostThreadBlocked | 0x10U))
+#define osHostThreadWaitingJoin       ((uint8_t)(osHostThreadBlocked | 0x20U))
+#define osHostThreadWaitingThreadFlags ((uint8_t)(osHostThreadBlocked | 0x30U))
+#define osHostThreadWaitingEventFlags ((uint8_t)(osHostThreadBlocked | 0x40U))
+#define osHostThreadWaitingMutex      ((uint8_t)(osHostThreadBlocked | 0x50U))
+#define osHostThreadWaitingSemaphore  ((uint8_t)(osHostThreadBlocked | 0x60U))
+#define osHostThreadWaitingMemoryPool ((uint8_t)(osHostThreadBlocked | 0x70U))
+#define osHostThreadWaitingMessageGet ((uint8_t)(osHostThreadBlocked | 0x80U))
+#define osHostThreadWaitingMessagePut ((uint8_t)(osHostThreadBlocked | 0x90U))
+#define osHostThreadWaitingTimer      ((uint8_t)(osHostThreadBlocked | 0xA0U))
+#define osHostThreadStateMask         0x0FU
+
+struct os_host_ctx_s;
+struct os_mutex_s;
+
+/* Thread Control Block */
+typedef struct os_thread_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  struct os_thread_s     *thread_next;  ///< Link pointer to next Thread in Object list
+  struct os_thread_s     *thread_prev;  ///< Link pointer to previous Thread in Object list
+  struct os_thread_s      *delay_next;  ///< Link pointer to next Thread in Delay list
+  struct os_thread_s      *delay_prev;  ///< Link pointer to previous Thread in Delay list
+  struct os_thread_s       *post_next;  ///< Link pointer to next Thread in list of all Threads
+  struct os_thread_s       *post_prev;  ///< Link pointer to previous Thread in list of all Threads
+  struct os_thread_s     *thread_join;  ///< Thread waiting to Join
+  struct os_thread_s        **list;     ///< List the Thread is linked in (ready or object list)
+  uint32_t                      delay;  ///< Delay expiration time (absolute tick)
+  int8_t                     priority;  ///< Thread Priority
+  int8_t                priority_base;  ///< Base Priority
+  uint8_t                 robin_slice;  ///< Remaining round-robin time slice
+  uint8_t                    reserved;
+  uint32_t                 wait_flags;  ///< Waiting Flags
+  uint32_t              flags_options;  ///< Flags Options
+  uint32_t               thread_flags;  ///< Thread Flags
+  uintptr_t                  wait_ret;  ///< Return value of the blocking function
+  void                      *wait_ptr;  ///< Blocking function argument
+  struct os_mutex_s       *mutex_list;  ///< Link pointer to list of owned Mutexes
+  void                     *stack_mem;  ///< Stack memory
+  uint32_t                 stack_size;  ///< Stack size
+  uint32_t                 stack_used;  ///< Stack usage estimate
+  osThreadFunc_t                 func;  ///< Thread function
+  void                       *argument; ///< Thread function argument
+  struct os_host_ctx_s           *ctx;  ///< Host thread context
+} os_thread_t;
+
+/* Timer Control Block */
+typedef struct os_timer_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        type;  ///< Timer Type (Periodic/One-shot)
+  const char                    *name;  ///< Object Name
+  struct os_timer_s             *prev;  ///< Pointer to previous active Timer
+  struct os_timer_s             *next;  ///< Pointer to next active Timer
+  struct os_timer_s        *fire_next;  ///< Pointer to next expired Timer
+  uint32_t                       tick;  ///< Expiration time (absolute tick)
+  uint32_t                       load;  ///< Timer Load value
+  osTimerFunc_t                  func;  ///< Timer Function
+  void                      *argument;  ///< Timer Function Argument
+} os_timer_t;
+
+/* Event Flags Control Block */
+typedef struct os_event_flags_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  const char                    *name;  ///< Object Name
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  uint32_t                event_flags;  ///< Event Flags
+} os_event_flags_t;
+
+/* Mutex Control Block */
+typedef struct os_mutex_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  os_thread_t           *owner_thread;  ///< Owner Thread
+  struct os_mutex_s        *owner_prev; ///< Pointer to previous owned Mutex
+  struct os_mutex_s        *owner_next; ///< Pointer to next owned Mutex
+  uint32_t                       lock;  ///< Lock counter
+} os_mutex_t;
+
+/* Semaphore Control Block */
+typedef struct os_semaphore_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  const char                    *name;  ///< Object Name
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  uint32_t                     tokens;  ///< Current number of tokens
+  uint32_t                 max_tokens;  ///< Maximum number of tokens
+} os_semaphore_t;
+
+/* Memory Pool Control Block */
+typedef struct os_memory_pool_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  const char                    *name;  ///< Object Name
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  void                     *block_base; ///< Memory blocks base address
+  void                      *block_lim; ///< Memory blocks limit address
+  void                     *block_free; ///< First free block address
+  uint32_t                  max_blocks; ///< Maximum number of blocks
+  uint32_t                 used_blocks; ///< Number of used blocks
+  uint32_t                 block_size;  ///< Block size
+} os_memory_pool_t;
+
+/* Message Queue Control Block */
+typedef struct os_message_queue_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  const char                    *name;  ///< Object Name
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  uint8_t                        *buf;  ///< Message buffer (msg_count slots)
+  uint32_t                  msg_count;  ///< Maximum number of messages
+  uint32_t                   msg_size;  ///< Message size
+  uint32_t                   msg_used;  ///< Number of queued messages
+  uint32_t                   msg_head;  ///< Index of the first queued message
+} os_message_queue_t;
+
+/* Control block sizes */
+#define osHostThreadCbSize            sizeof(os_thread_t)
+#define osHostTimerCbSize             sizeof(os_timer_t)
+#define osHostEventFlagsCbSize        sizeof(os_event_flags_t)
+#define osHostMutexCbSize             sizeof(os_mutex_t)
+#define osHostSemaphoreCbSize         sizeof(os_semaphore_t)
+#define osHostMemoryPoolCbSize        sizeof(os_memory_pool_t)
+#define osHostMessageQueueCbSize      sizeof(os_message_queue_t)
+
+/* Memory pool data size for block_count blocks of block_size bytes */
+#define osHostMemoryPoolMemSize(block_count, block_size) \
+  ((block_count) * (((block_size) + 7U) & ~7U))
+
+/* Message queue data size for msg_count messages of msg_size bytes */
+#define osHostMessageQueueMemSize(msg_count, msg_size) \
+  ((msg_count) * (((msg_size) + 1U + 7U) & ~7U))
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* OS_HOST_H_ */
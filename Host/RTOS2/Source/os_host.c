@@ -0,0 +1,2822 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 Validation (host build)
+ * Title:       CMSIS-RTOS2 stand-in kernel on top of POSIX threads
+ *
+ * Every RTOS thread is backed by a POSIX thread, but only the thread that
+ * owns the execution baton (os_host_running) is allowed to run. The kernel
+ * passes the baton on every context switch, which gives the same strictly
+ * priority based, single-core scheduling as a real RTOS kernel.
+ *
+ * Interrupts are emulated with POSIX signals that are delivered to the
+ * thread that currently owns the baton:
+ *  - SIGALRM: kernel tick, raised by a non-RTOS ticker thread
+ *  - SIGUSR1: interrupt lines of the emulated interrupt controller
+ *
+ * The signal handler runs the kernel tick and the registered interrupt
+ * handlers in interrupt context and preempts the interrupted thread when
+ * a higher priority thread became ready. Kernel services run in a critical
+ * section (os_crit) during which interrupts are kept pending.
+ *
+ * Time is virtual: the tick is by default driven by the CPU time consumed
+ * by the process and when all threads are blocked the idle thread advances
+ * the kernel tick straight to the next timeout, which allows the complete
+ * validation suite to run in seconds.
+ * ----------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "os_host.h"
+#include "irq_ctrl.h"
+
+/*-----------------------------------------------------------------------------
+ *      Definitions
+ *----------------------------------------------------------------------------*/
+
+/* Kernel information */
+#define OS_HOST_API_VERSION     20030000U   /* API version:    2.3.0 */
+#define OS_HOST_KERNEL_VERSION  10000000U   /* Kernel version: 1.0.0 */
+#define OS_HOST_KERNEL_ID       "Host RTOS2 V1.0.0"
+
+/* Signals used to emulate the tick and the interrupt lines */
+#define OS_HOST_SIG_TICK        SIGALRM
+#define OS_HOST_SIG_IRQ         SIGUSR1
+
+/* Pending interrupt bit of the kernel tick (interrupt lines use bits 0..n) */
+#define OS_HOST_PEND_TICK       (1UL << 31)
+
+/* Estimated stack usage reported by osThreadGetStackSpace [bytes] */
+#define OS_HOST_STACK_FRAME     64U
+
+/* Minimum size of the user provided thread stack [bytes] */
+#define OS_HOST_STACK_MIN       72U
+
+/* Semaphore token limit */
+#define OS_HOST_SEMAPHORE_TOKEN_LIMIT 65535U
+
+/* Mutex lock counter limit */
+#define OS_HOST_MUTEX_LOCK_LIMIT      255U
+
+/* Timer states */
+#define OS_HOST_TIMER_INACTIVE  0x00U
+#define OS_HOST_TIMER_STOPPED   0x01U
+#define OS_HOST_TIMER_RUNNING   0x02U
+
+/* Timer queued for the timer thread (object flag) */
+#define OS_HOST_FLAG_TIMER_QUEUED 0x80U
+
+/* Mutex state: owner terminated without releasing a non-robust mutex */
+#define OS_HOST_MUTEX_ORPHANED  0x01U
+
+/* Host thread context */
+typedef struct os_host_ctx_s {
+  pthread_t                  pthread;   ///< POSIX thread
+  sem_t                          sem;   ///< Baton semaphore
+  sigjmp_buf                     jmp;   ///< Exit point of terminated thread
+  volatile sig_atomic_t         exit;   ///< Thread terminated by other thread
+  os_thread_t        * volatile thread; ///< RTOS thread executed by the context
+  struct os_host_ctx_s         *next;   ///< Next context in the free pool
+} os_host_ctx_t;
+
+/* Common object header */
+typedef struct {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  const char                    *name;  ///< Object Name
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+} os_object_t;
+
+/* Message queue put/get wait arguments */
+typedef struct {
+  void                           *msg;  ///< Message buffer
+  uint8_t                       *prio;  ///< Message priority
+} os_message_wait_t;
+
+/*-----------------------------------------------------------------------------
+ *      Kernel state
+ *----------------------------------------------------------------------------*/
+
+/* Kernel state */
+static volatile osKernelState_t os_kernel_state = osKernelInactive;
+
+/* Kernel tick counter and wall clock time of the last tick [ns] */
+static volatile uint32_t os_tick_count;
+static volatile uint64_t os_tick_time;
+
+/* Wall clock time of the next tick [ns] */
+static volatile uint64_t os_tick_deadline;
+
+/* Thread lists */
+static os_thread_t *os_thread_running;    ///< Running thread
+static os_thread_t *os_ready_list;        ///< Ready threads (priority order)
+static os_thread_t *os_delay_list;        ///< Delayed threads (expiry order)
+static os_thread_t *os_post_list;         ///< All created threads
+static uint8_t      os_robin_yield;       ///< Round-robin switch request
+
+/* Timers */
+static os_timer_t  *os_timer_list;        ///< Running timers (expiry order)
+static os_timer_t  *os_timer_fire_head;   ///< Expired timers (FIFO)
+static os_timer_t  *os_timer_fire_tail;
+static os_thread_t *os_timer_thread;      ///< Timer thread
+static os_thread_t *os_idle_thread;       ///< Idle thread
+
+/* Free lists of kernel allocated control blocks (indexed by object id) */
+static void        *os_free_list[16];
+
+/* Kernel critical section flag and interrupt nesting level */
+static volatile sig_atomic_t os_crit;
+static volatile sig_atomic_t os_isr_nest;
+
+/* Emulated interrupt controller */
+static volatile uint32_t os_irq_pend;
+static volatile uint32_t os_irq_enable;
+static uint32_t          os_irq_mode;
+static IRQHandler_t      os_irq_handler[IRQ_HOST_NUM];
+
+/* Host thread contexts */
+static os_host_ctx_t * volatile os_host_running;  ///< Context owning the baton
+static __thread os_host_ctx_t  *os_host_self;     ///< Context of the calling thread
+static os_host_ctx_t           *os_host_pool;     ///< Free contexts
+static pthread_mutex_t          os_host_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t                os_host_ticker;
+
+/* Prototypes */
+static void os_thread_idle  (void *argument);
+static void os_thread_timer (void *argument);
+static void os_mutex_owner_release (os_thread_t *thread);
+static void os_thread_priority_update (os_thread_t *thread);
+
+/*-----------------------------------------------------------------------------
+ *      Host helpers
+ *----------------------------------------------------------------------------*/
+
+/* Tick clock time [ns] */
+static uint64_t os_host_time (void) {
+  struct timespec ts;
+
+  clock_gettime(OS_HOST_TICK_CLOCK, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+/* Tick period [ns] */
+static uint64_t os_host_tick_period (void) {
+  return (1000000000ULL / OS_HOST_TICK_FREQ);
+}
+
+/* Kernel signal set */
+static void os_host_sigset (sigset_t *set) {
+  sigemptyset(set);
+  sigaddset(set, OS_HOST_SIG_TICK);
+  sigaddset(set, OS_HOST_SIG_IRQ);
+}
+
+/* Wait until the calling context owns the baton */
+static void os_host_wait (os_host_ctx_t *ctx) {
+
+  while (__atomic_load_n(&os_host_running, __ATOMIC_SEQ_CST) != ctx) {
+    if (ctx->exit != 0) {
+      siglongjmp(ctx->jmp, 1);
+    }
+    (void)sem_wait(&ctx->sem);
+  }
+}
+
+/* Pass the baton to context next */
+static void os_host_post (os_host_ctx_t *next) {
+  __atomic_store_n(&os_host_running, next, __ATOMIC_SEQ_CST);
+  (void)sem_post(&next->sem);
+}
+
+/* Check if the calling thread runs in thread mode and owns the baton */
+static uint32_t os_host_thread_mode (void) {
+  os_host_ctx_t *self = os_host_self;
+
+  return ((self != NULL) && (self == os_host_running) && (os_isr_nest == 0));
+}
+
+/*-----------------------------------------------------------------------------
+ *      Kernel critical section and interrupt dispatching
+ *----------------------------------------------------------------------------*/
+
+static void     os_tick_handler (void);
+static uint32_t os_thread_dispatch (void);
+
+/* Enter kernel critical section */
+static void os_kernel_enter (void) {
+  os_crit = 1;
+  __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+/* Service pending interrupts and perform pending thread switches */
+static void os_kernel_service (void) {
+  uint32_t pend, bit;
+  uint32_t n;
+
+  for (;;) {
+    pend = __atomic_load_n(&os_irq_pend, __ATOMIC_SEQ_CST) & (os_irq_enable | OS_HOST_PEND_TICK);
+    if (pend != 0U) {
+      bit = pend & (~pend + 1U);
+      __atomic_and_fetch(&os_irq_pend, ~bit, __ATOMIC_SEQ_CST);
+
+      os_isr_nest++;
+      if (bit == OS_HOST_PEND_TICK) {
+        os_tick_handler();
+      } else {
+        n = (uint32_t)__builtin_ctz(bit);
+        if (os_irq_handler[n] != NULL) {
+          /* Interrupt handlers call kernel services: leave critical section */
+          os_crit = 0;
+          __atomic_signal_fence(__ATOMIC_SEQ_CST);
+          os_irq_handler[n]();
+          os_crit = 1;
+          __atomic_signal_fence(__ATOMIC_SEQ_CST);
+        }
+      }
+      os_isr_nest--;
+      continue;
+    }
+    if (os_thread_dispatch() == 0U) {
+      break;
+    }
+  }
+}
+
+/* Exit kernel critical section */
+static void os_kernel_exit (void) {
+  uint32_t pend;
+
+  for (;;) {
+    if (os_host_thread_mode()) {
+      os_kernel_service();
+    }
+    os_crit = 0;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+
+    if (!os_host_thread_mode()) {
+      break;
+    }
+    pend = __atomic_load_n(&os_irq_pend, __ATOMIC_SEQ_CST) & (os_irq_enable | OS_HOST_PEND_TICK);
+    if ((pend == 0U) && (os_robin_yield == 0U)) {
+      break;
+    }
+    os_crit = 1;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+  }
+}
+
+/* Tick and interrupt signal handler */
+static void os_host_signal_handler (int sig) {
+  int err = errno;
+
+  (void)sig;
+
+  if (os_host_thread_mode() && (os_crit == 0)) {
+    os_kernel_enter();
+    os_kernel_exit();
+  }
+  errno = err;
+}
+
+/* Ticker thread: raises the tick interrupt every tick period */
+static void *os_host_ticker_thread (void *arg) {
+  struct timespec ts;
+  os_host_ctx_t  *ctx;
+  uint64_t deadline, now;
+
+  (void)arg;
+
+  for (;;) {
+    deadline = __atomic_load_n(&os_tick_deadline, __ATOMIC_SEQ_CST);
+    now      = os_host_time();
+    if (now < deadline) {
+      ts.tv_sec  = (time_t)(deadline / 1000000000ULL);
+      ts.tv_nsec = (long)  (deadline % 1000000000ULL);
+      (void)clock_nanosleep(OS_HOST_TICK_CLOCK, TIMER_ABSTIME, &ts, NULL);
+      continue;
+    }
+    __atomic_or_fetch(&os_irq_pend, OS_HOST_PEND_TICK, __ATOMIC_SEQ_CST);
+
+    ctx = __atomic_load_n(&os_host_running, __ATOMIC_SEQ_CST);
+    if (ctx != NULL) {
+      (void)pthread_kill(ctx->pthread, OS_HOST_SIG_TICK);
+    }
+    /* Retry after a tick period when the tick was not serviced */
+    __atomic_store_n(&os_tick_deadline, now + os_host_tick_period(), __ATOMIC_SEQ_CST);
+  }
+  return NULL;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Host thread contexts
+ *----------------------------------------------------------------------------*/
+
+/* Return a context to the free pool */
+static void os_host_ctx_free (os_host_ctx_t *ctx) {
+  ctx->thread = NULL;
+  ctx->exit   = 0;
+  pthread_mutex_lock(&os_host_pool_mutex);
+  ctx->next    = os_host_pool;
+  os_host_pool = ctx;
+  pthread_mutex_unlock(&os_host_pool_mutex);
+}
+
+/* Host thread executing RTOS threads */
+static void *os_host_ctx_thread (void *arg) {
+  os_host_ctx_t * volatile ctx = (os_host_ctx_t *)arg;
+  os_thread_t *thread;
+  sigset_t set;
+
+  os_host_self = ctx;
+
+  os_host_sigset(&set);
+  pthread_sigmask(SIG_UNBLOCK, &set, NULL);
+
+  if (sigsetjmp(ctx->jmp, 1) != 0) {
+    /* RTOS thread was terminated */
+    os_host_ctx_free(ctx);
+  }
+
+  for (;;) {
+    os_host_wait(ctx);
+
+    thread = ctx->thread;
+    os_kernel_exit();
+
+    thread->func(thread->argument);
+
+    osThreadExit();
+  }
+  return NULL;
+}
+
+/* Get a host thread context for a new RTOS thread */
+static os_host_ctx_t *os_host_ctx_alloc (void) {
+  pthread_attr_t attr;
+  os_host_ctx_t *ctx;
+
+  pthread_mutex_lock(&os_host_pool_mutex);
+  ctx = os_host_pool;
+  if (ctx != NULL) {
+    os_host_pool = ctx->next;
+  }
+  pthread_mutex_unlock(&os_host_pool_mutex);
+
+  if (ctx == NULL) {
+    ctx = calloc(1U, sizeof(os_host_ctx_t));
+    if (ctx != NULL) {
+      (void)sem_init(&ctx->sem, 0, 0U);
+
+      pthread_attr_init(&attr);
+      pthread_attr_setstacksize(&attr, OS_HOST_PTHREAD_STACK_SIZE);
+      if (pthread_create(&ctx->pthread, &attr, os_host_ctx_thread, ctx) != 0) {
+        (void)sem_destroy(&ctx->sem);
+        free(ctx);
+        ctx = NULL;
+      }
+      pthread_attr_destroy(&attr);
+    }
+  }
+  return ctx;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Object helpers
+ *----------------------------------------------------------------------------*/
+
+/* Check object identifier */
+static uint32_t os_object_valid (const void *object, uint8_t id) {
+  return ((object != NULL) && (((const os_object_t *)object)->id == id));
+}
+
+/* Allocate control block (user provided or kernel memory) */
+static void *os_object_alloc (uint8_t id, void *cb_mem, uint32_t cb_size, size_t size, uint8_t *flags) {
+  void *object;
+
+  if (cb_mem != NULL) {
+    if ((((uintptr_t)cb_mem & 3U) != 0U) || (cb_size < size)) {
+      return NULL;
+    }
+    memset(cb_mem, 0, size);
+    *flags = 0U;
+    return cb_mem;
+  }
+  if (cb_size != 0U) {
+    return NULL;
+  }
+
+  /* Reuse deleted control blocks (stale ids keep failing the id check) */
+  object = os_free_list[id & 0x0FU];
+  if (object != NULL) {
+    memcpy(&os_free_list[id & 0x0FU], &((os_object_t *)object)->name, sizeof(void *));
+    memset(object, 0, size);
+  } else {
+    object = calloc(1U, size);
+  }
+  *flags = osHostFlagSystemObject;
+  return object;
+}
+
+/* Release control block */
+static void os_object_free (void *object) {
+  os_object_t *obj = (os_object_t *)object;
+  uint8_t id = obj->id;
+
+  obj->id = osHostIdInvalid;
+  if ((obj->flags & osHostFlagSystemObject) != 0U) {
+    memcpy(&obj->name, &os_free_list[id & 0x0FU], sizeof(void *));
+    os_free_list[id & 0x0FU] = object;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ *      Thread lists
+ *----------------------------------------------------------------------------*/
+
+/* Put thread into list (priority order, FIFO within the same priority) */
+static void os_thread_list_put (os_thread_t **list, os_thread_t *thread) {
+  os_thread_t *prev = NULL;
+  os_thread_t *next = *list;
+
+  while ((next != NULL) && (next->priority >= thread->priority)) {
+    prev = next;
+    next = next->thread_next;
+  }
+  thread->thread_prev = prev;
+  thread->thread_next = next;
+  thread->list        = list;
+  if (prev != NULL) {
+    prev->thread_next = thread;
+  } else {
+    *list = thread;
+  }
+  if (next != NULL) {
+    next->thread_prev = thread;
+  }
+}
+
+/* Remove thread from its list */
+static void os_thread_list_remove (os_thread_t *thread) {
+
+  if (thread->list == NULL) {
+    return;
+  }
+  if (thread->thread_prev != NULL) {
+    thread->thread_prev->thread_next = thread->thread_next;
+  } else {
+    *thread->list = thread->thread_next;
+  }
+  if (thread->thread_next != NULL) {
+    thread->thread_next->thread_prev = thread->thread_prev;
+  }
+  thread->thread_next = NULL;
+  thread->thread_prev = NULL;
+  thread->list        = NULL;
+}
+
+/* Get thread with highest priority from list */
+static os_thread_t *os_thread_list_get (os_thread_t **list) {
+  os_thread_t *thread = *list;
+
+  if (thread != NULL) {
+    os_thread_list_remove(thread);
+  }
+  return thread;
+}
+
+/* Put thread into ready list */
+static void os_thread_ready_put (os_thread_t *thread) {
+  thread->state = osHostThreadReady;
+  os_thread_list_put(&os_ready_list, thread);
+}
+
+/* Insert thread into delay list */
+static void os_thread_delay_insert (os_thread_t *thread, uint32_t ticks) {
+  os_thread_t *prev = NULL;
+  os_thread_t *next = os_delay_list;
+
+  thread->delay = os_tick_count + ticks;
+
+  while ((next != NULL) && ((int32_t)(next->delay - thread->delay) <= 0)) {
+    prev = next;
+    next = next->delay_next;
+  }
+  thread->delay_prev = prev;
+  thread->delay_next = next;
+  if (prev != NULL) {
+    prev->delay_next = thread;
+  } else {
+    os_delay_list = thread;
+  }
+  if (next != NULL) {
+    next->delay_prev = thread;
+  }
+}
+
+/* Remove thread from delay list */
+static void os_thread_delay_remove (os_thread_t *thread) {
+
+  if ((thread->delay_prev == NULL) && (os_delay_list != thread)) {
+    return;
+  }
+  if (thread->delay_prev != NULL) {
+    thread->delay_prev->delay_next = thread->delay_next;
+  } else {
+    os_delay_list = thread->delay_next;
+  }
+  if (thread->delay_next != NULL) {
+    thread->delay_next->delay_prev = thread->delay_prev;
+  }
+  thread->delay_next = NULL;
+  thread->delay_prev = NULL;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Scheduler
+ *----------------------------------------------------------------------------*/
+
+/* Switch to thread (thread is already removed from the ready list) */
+static void os_thread_switch (os_thread_t *thread) {
+  os_host_ctx_t *self = os_host_self;
+
+  thread->state       = osHostThreadRunning;
+  thread->robin_slice = OS_HOST_ROBIN_TIMEOUT;
+  os_thread_running   = thread;
+
+  if (thread->ctx != self) {
+    os_host_post(thread->ctx);
+    if (self != NULL) {
+      os_host_wait(self);
+    }
+  }
+}
+
+/* Preempt the running thread when a higher priority thread is ready */
+static uint32_t os_thread_dispatch (void) {
+  os_thread_t *thread = os_thread_running;
+  os_thread_t *next   = os_ready_list;
+
+  if ((os_kernel_state != osKernelRunning) || (next == NULL) || (thread == NULL) ||
+      (thread->state != osHostThreadRunning)) {
+    os_robin_yield = 0U;
+    return 0U;
+  }
+  if ((next->priority > thread->priority) ||
+      ((os_robin_yield != 0U) && (next->priority == thread->priority))) {
+    os_robin_yield = 0U;
+    os_thread_list_remove(next);
+    os_thread_ready_put(thread);
+    os_thread_switch(next);
+    return 1U;
+  }
+  os_robin_yield = 0U;
+  return 0U;
+}
+
+/* Check if the running thread may block */
+static uint32_t os_thread_wait_allowed (void) {
+  return ((os_kernel_state == osKernelRunning) && (os_isr_nest == 0));
+}
+
+/* Block the running thread
+
+   \param[in]  state       wait state
+   \param[in]  list        object list to wait in (NULL when none)
+   \param[in]  timeout     timeout in ticks (osWaitForever for no timeout)
+   \param[in]  timeout_ret value returned when the wait times out
+   \return     value passed to the wakeup function or timeout_ret
+*/
+static uintptr_t os_thread_wait_enter (uint8_t state, os_thread_t **list, uint32_t timeout, uintptr_t timeout_ret) {
+  os_thread_t *thread = os_thread_running;
+  os_thread_t *next;
+
+  if (!os_thread_wait_allowed()) {
+    return timeout_ret;
+  }
+  thread->state    = state;
+  thread->wait_ret = timeout_ret;
+  if (list != NULL) {
+    os_thread_list_put(list, thread);
+  }
+  if (timeout != osWaitForever) {
+    os_thread_delay_insert(thread, timeout);
+  }
+
+  next = os_thread_list_get(&os_ready_list);
+  os_thread_switch(next);
+
+  return thread->wait_ret;
+}
+
+/* Wakeup a blocked thread */
+static void os_thread_wait_exit (os_thread_t *thread, uintptr_t ret) {
+  thread->wait_ret = ret;
+  os_thread_list_remove(thread);
+  os_thread_delay_remove(thread);
+  os_thread_ready_put(thread);
+}
+
+/* Cancel the wait of a blocked thread (timeout, suspend, terminate) */
+static void os_thread_wait_cancel (os_thread_t *thread) {
+  os_mutex_t *mutex;
+
+  os_thread_list_remove(thread);
+  os_thread_delay_remove(thread);
+
+  switch (thread->state) {
+    case osHostThreadWaitingMutex:
+      /* Owner may have inherited the priority of the thread */
+      mutex = (os_mutex_t *)thread->wait_ptr;
+      if ((mutex->owner_thread != NULL) && ((mutex->state & OS_HOST_MUTEX_ORPHANED) == 0U)) {
+        os_thread_priority_update(mutex->owner_thread);
+      }
+      break;
+    case osHostThreadWaitingJoin:
+      ((os_thread_t *)thread->wait_ptr)->thread_join = NULL;
+      break;
+    default:
+      break;
+  }
+}
+
+/* Recalculate thread priority (base priority and inherited priority) */
+static void os_thread_priority_update (os_thread_t *thread) {
+  os_mutex_t *mutex;
+  int8_t priority;
+
+  for (;;) {
+    priority = thread->priority_base;
+    for (mutex = thread->mutex_list; mutex != NULL; mutex = mutex->owner_next) {
+      if (((mutex->attr & osMutexPrioInherit) != 0U) && (mutex->thread_list != NULL)) {
+        if (mutex->thread_list->priority > priority) {
+          priority = mutex->thread_list->priority;
+        }
+      }
+    }
+    if (priority == thread->priority) {
+      break;
+    }
+    thread->priority = priority;
+
+    /* Re-sort the thread in its list */
+    if (thread->list != NULL) {
+      os_thread_t **list = thread->list;
+      os_thread_list_remove(thread);
+      os_thread_list_put(list, thread);
+    }
+
+    /* Propagate along the chain of blocked mutex owners */
+    if (thread->state != osHostThreadWaitingMutex) {
+      break;
+    }
+    mutex = (os_mutex_t *)thread->wait_ptr;
+    if (((mutex->attr & osMutexPrioInherit) == 0U) || (mutex->owner_thread == NULL) ||
+        ((mutex->state & OS_HOST_MUTEX_ORPHANED) != 0U)) {
+      break;
+    }
+    thread = mutex->owner_thread;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ *      Kernel tick
+ *----------------------------------------------------------------------------*/
+
+/* Insert timer into the list of running timers */
+static void os_timer_insert (os_timer_t *timer, uint32_t tick) {
+  os_timer_t *prev = NULL;
+  os_timer_t *next = os_timer_list;
+
+  timer->tick = tick;
+  while ((next != NULL) && ((int32_t)(next->tick - tick) <= 0)) {
+    prev = next;
+    next = next->next;
+  }
+  timer->prev = prev;
+  timer->next = next;
+  if (prev != NULL) {
+    prev->next = timer;
+  } else {
+    os_timer_list = timer;
+  }
+  if (next != NULL) {
+    next->prev = timer;
+  }
+}
+
+/* Remove timer from the list of running timers */
+static void os_timer_remove (os_timer_t *timer) {
+
+  if (timer->prev != NULL) {
+    timer->prev->next = timer->next;
+  } else {
+    os_timer_list = timer->next;
+  }
+  if (timer->next != NULL) {
+    timer->next->prev = timer->prev;
+  }
+  timer->prev = NULL;
+  timer->next = NULL;
+}
+
+/* Remove timer from the queue of expired timers */
+static void os_timer_unqueue (os_timer_t *timer) {
+  os_timer_t *prev = NULL;
+  os_timer_t *t;
+
+  if ((timer->flags & OS_HOST_FLAG_TIMER_QUEUED) == 0U) {
+    return;
+  }
+  for (t = os_timer_fire_head; t != NULL; prev = t, t = t->fire_next) {
+    if (t == timer) {
+      if (prev != NULL) {
+        prev->fire_next = t->fire_next;
+      } else {
+        os_timer_fire_head = t->fire_next;
+      }
+      if (os_timer_fire_tail == t) {
+        os_timer_fire_tail = prev;
+      }
+      break;
+    }
+  }
+  timer->fire_next = NULL;
+  timer->flags &= (uint8_t)~OS_HOST_FLAG_TIMER_QUEUED;
+}
+
+/* Process thread delays and timers up to the current tick */
+static void os_tick_process (void) {
+  os_thread_t *thread;
+  os_timer_t  *timer;
+
+  /* Thread delays */
+  while (((thread = os_delay_list) != NULL) && ((int32_t)(thread->delay - os_tick_count) <= 0)) {
+    os_thread_wait_cancel(thread);
+    os_thread_ready_put(thread);
+  }
+
+  /* Timers */
+  while (((timer = os_timer_list) != NULL) && ((int32_t)(timer->tick - os_tick_count) <= 0)) {
+    os_timer_remove(timer);
+    if (timer->type == osTimerPeriodic) {
+      os_timer_insert(timer, timer->tick + timer->load);
+    } else {
+      timer->state = OS_HOST_TIMER_STOPPED;
+    }
+    if ((timer->flags & OS_HOST_FLAG_TIMER_QUEUED) == 0U) {
+      timer->flags    |= OS_HOST_FLAG_TIMER_QUEUED;
+      timer->fire_next = NULL;
+      if (os_timer_fire_tail != NULL) {
+        os_timer_fire_tail->fire_next = timer;
+      } else {
+        os_timer_fire_head = timer;
+      }
+      os_timer_fire_tail = timer;
+    }
+  }
+  if ((os_timer_fire_head != NULL) && (os_timer_thread != NULL) &&
+      (os_timer_thread->state == osHostThreadWaitingTimer)) {
+    os_thread_wait_exit(os_timer_thread, 0U);
+  }
+}
+
+/* Kernel tick handler (interrupt context, kernel critical section) */
+static void os_tick_handler (void) {
+  os_thread_t *thread;
+  uint64_t now = os_host_time();
+
+  __atomic_store_n(&os_tick_deadline, now + os_host_tick_period(), __ATOMIC_SEQ_CST);
+
+  if ((os_kernel_state != osKernelRunning) && (os_kernel_state != osKernelLocked)) {
+    return;
+  }
+  os_tick_count++;
+  os_tick_time = now;
+
+  os_tick_process();
+
+  /* Round-robin */
+  thread = os_thread_running;
+  if ((OS_HOST_ROBIN_ENABLE != 0) && (thread != NULL) && (thread->state == osHostThreadRunning)) {
+    if (thread->robin_slice != 0U) {
+      thread->robin_slice--;
+    }
+    if (thread->robin_slice == 0U) {
+      thread->robin_slice = OS_HOST_ROBIN_TIMEOUT;
+      if ((os_kernel_state == osKernelRunning) && (os_ready_list != NULL) &&
+          (os_ready_list->priority == thread->priority)) {
+        os_robin_yield = 1U;
+      }
+    }
+  }
+}
+
+/* Number of ticks until the next thread or timer timeout (osWaitForever: none) */
+static uint32_t os_tick_next_timeout (void) {
+  uint32_t delay = osWaitForever;
+  int32_t  d;
+
+  if (os_delay_list != NULL) {
+    d = (int32_t)(os_delay_list->delay - os_tick_count);
+    delay = (d > 0) ? (uint32_t)d : 0U;
+  }
+  if (os_timer_list != NULL) {
+    d = (int32_t)(os_timer_list->tick - os_tick_count);
+    if (d < 0) {
+      d = 0;
+    }
+    if ((uint32_t)d < delay) {
+      delay = (uint32_t)d;
+    }
+  }
+  return delay;
+}
+
+/*-----------------------------------------------------------------------------
+ *      System threads
+ *----------------------------------------------------------------------------*/
+
+/* Idle thread: skips idle time when all other threads are blocked */
+static void os_thread_idle (void *argument) {
+  uint32_t delay;
+  uint32_t skip;
+
+  (void)argument;
+
+  for (;;) {
+    skip = 0U;
+    os_kernel_enter();
+    if (os_kernel_state == osKernelRunning) {
+      if (os_ready_list != NULL) {
+        /* Other idle priority threads are ready */
+        os_robin_yield = 1U;
+        skip = 1U;
+      } else if (OS_HOST_IDLE_SKIP != 0) {
+        delay = os_tick_next_timeout();
+        if (delay != osWaitForever) {
+          if (delay > 1U) {
+            os_tick_count += delay - 1U;
+          }
+          os_isr_nest++;
+          os_tick_handler();
+          os_isr_nest--;
+          skip = 1U;
+        }
+      }
+    }
+    os_kernel_exit();
+
+    if ((skip == 0U) && ((OS_HOST_IDLE_SKIP != 0) || (OS_HOST_TICK_CLOCK == CLOCK_MONOTONIC))) {
+      /* Nothing to do until the next interrupt (a CPU time clock needs
+         the idle thread to spin when idle time is not skipped) */
+      (void)pause();
+    }
+  }
+}
+
+/* Timer thread: executes the callbacks of expired timers */
+static void os_thread_timer (void *argument) {
+  os_timer_t   *timer;
+  osTimerFunc_t func;
+  void         *arg;
+
+  (void)argument;
+
+  for (;;) {
+    os_kernel_enter();
+    timer = os_timer_fire_head;
+    if (timer == NULL) {
+      (void)os_thread_wait_enter(osHostThreadWaitingTimer, NULL, osWaitForever, 0U);
+      os_kernel_exit();
+      continue;
+    }
+    os_timer_fire_head = timer->fire_next;
+    if (os_timer_fire_head == NULL) {
+      os_timer_fire_tail = NULL;
+    }
+    timer->fire_next = NULL;
+    timer->flags    &= (uint8_t)~OS_HOST_FLAG_TIMER_QUEUED;
+    func = timer->func;
+    arg  = timer->argument;
+    os_kernel_exit();
+
+    func(arg);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ *      Kernel Management
+ *----------------------------------------------------------------------------*/
+
+osStatus_t osKernelInitialize (void) {
+  struct sigaction sa;
+  sigset_t set;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (os_kernel_state == osKernelReady) {
+    return osOK;
+  }
+  if (os_kernel_state != osKernelInactive) {
+    return osError;
+  }
+
+  /* Kernel signals are only delivered to RTOS threads */
+  os_host_sigset(&set);
+  pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = os_host_signal_handler;
+  sa.sa_flags   = SA_RESTART;
+  os_host_sigset(&sa.sa_mask);
+  sigaction(OS_HOST_SIG_TICK, &sa, NULL);
+  sigaction(OS_HOST_SIG_IRQ,  &sa, NULL);
+
+  os_tick_count   = 0U;
+  os_kernel_state = osKernelReady;
+
+  /* Create system threads */
+  {
+    const osThreadAttr_t idle_attr  = { "osHostIdleThread",  osThreadDetached, NULL, 0U, NULL, 0U, osPriorityIdle,            0U, 0U };
+    const osThreadAttr_t timer_attr = { "osHostTimerThread", osThreadDetached, NULL, 0U, NULL, 0U, OS_HOST_TIMER_THREAD_PRIO, 0U, 0U };
+
+    os_idle_thread  = (os_thread_t *)osThreadNew(os_thread_idle,  NULL, &idle_attr);
+    os_timer_thread = (os_thread_t *)osThreadNew(os_thread_timer, NULL, &timer_attr);
+  }
+  if ((os_idle_thread == NULL) || (os_timer_thread == NULL)) {
+    os_kernel_state = osKernelError;
+    return osError;
+  }
+  return osOK;
+}
+
+osStatus_t osKernelGetInfo (osVersion_t *version, char *id_buf, uint32_t id_size) {
+  uint32_t size;
+
+  if (version != NULL) {
+    version->api    = OS_HOST_API_VERSION;
+    version->kernel = OS_HOST_KERNEL_VERSION;
+  }
+  if ((id_buf != NULL) && (id_size != 0U)) {
+    size = sizeof(OS_HOST_KERNEL_ID);
+    if (size > id_size) {
+      size = id_size;
+    }
+    memcpy(id_buf, OS_HOST_KERNEL_ID, size);
+    id_buf[size - 1U] = '\0';
+  }
+  return osOK;
+}
+
+osKernelState_t osKernelGetState (void) {
+  return os_kernel_state;
+}
+
+osStatus_t osKernelStart (void) {
+  os_thread_t *thread;
+  sigset_t set;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (os_kernel_state != osKernelReady) {
+    return osError;
+  }
+
+  os_kernel_enter();
+  os_kernel_state  = osKernelRunning;
+  os_tick_time     = os_host_time();
+  os_tick_deadline = os_tick_time + os_host_tick_period();
+
+  if (pthread_create(&os_host_ticker, NULL, os_host_ticker_thread, NULL) != 0) {
+    os_kernel_state = osKernelError;
+    os_crit = 0;
+    return osError;
+  }
+
+  /* Start the thread with the highest priority (keeps the critical section) */
+  thread = os_thread_list_get(&os_ready_list);
+  os_thread_switch(thread);
+
+  /* The calling (process main) thread is not an RTOS thread: park it */
+  sigfillset(&set);
+  pthread_sigmask(SIG_BLOCK, &set, NULL);
+  for (;;) {
+    (void)pause();
+  }
+  return osOK;
+}
+
+int32_t osKernelLock (void) {
+  int32_t lock;
+
+  if (os_isr_nest != 0) {
+    return (int32_t)osErrorISR;
+  }
+  os_kernel_enter();
+  switch (os_kernel_state) {
+    case osKernelRunning:
+      os_kernel_state = osKernelLocked;
+      lock = 0;
+      break;
+    case osKernelLocked:
+      lock = 1;
+      break;
+    default:
+      lock = (int32_t)osError;
+      break;
+  }
+  os_kernel_exit();
+  return lock;
+}
+
+int32_t osKernelUnlock (void) {
+  int32_t lock;
+
+  if (os_isr_nest != 0) {
+    return (int32_t)osErrorISR;
+  }
+  os_kernel_enter();
+  switch (os_kernel_state) {
+    case osKernelRunning:
+      lock = 0;
+      break;
+    case osKernelLocked:
+      os_kernel_state = osKernelRunning;
+      lock = 1;
+      break;
+    default:
+      lock = (int32_t)osError;
+      break;
+  }
+  os_kernel_exit();
+  return lock;
+}
+
+int32_t osKernelRestoreLock (int32_t lock) {
+  int32_t lock_new;
+
+  if (os_isr_nest != 0) {
+    return (int32_t)osErrorISR;
+  }
+  os_kernel_enter();
+  if ((os_kernel_state == osKernelRunning) || (os_kernel_state == osKernelLocked)) {
+    switch (lock) {
+      case 0:
+        os_kernel_state = osKernelRunning;
+        lock_new = 0;
+        break;
+      case 1:
+        os_kernel_state = osKernelLocked;
+        lock_new = 1;
+        break;
+      default:
+        lock_new = (int32_t)osError;
+        break;
+    }
+  } else {
+    lock_new = (int32_t)osError;
+  }
+  os_kernel_exit();
+  return lock_new;
+}
+
+uint32_t osKernelSuspend (void) {
+  uint32_t delay;
+
+  if (os_isr_nest != 0) {
+    return 0U;
+  }
+  os_kernel_enter();
+  if (os_kernel_state != osKernelRunning) {
+    os_kernel_exit();
+    return 0U;
+  }
+  os_kernel_state = osKernelSuspended;
+  delay = os_tick_next_timeout();
+  os_kernel_exit();
+  return delay;
+}
+
+void osKernelResume (uint32_t sleep_ticks) {
+
+  if (os_isr_nest != 0) {
+    return;
+  }
+  os_kernel_enter();
+  if (os_kernel_state == osKernelSuspended) {
+    /* Without sleep ticks keep the partial tick (system timer stays monotonic) */
+    if (sleep_ticks != 0U) {
+      os_tick_count += sleep_ticks;
+      os_tick_time   = os_host_time();
+    }
+    os_kernel_state = osKernelRunning;
+    os_tick_process();
+  }
+  os_kernel_exit();
+}
+
+uint32_t osKernelGetTickCount (void) {
+  return os_tick_count;
+}
+
+uint32_t osKernelGetTickFreq (void) {
+  return OS_HOST_TICK_FREQ;
+}
+
+uint32_t osKernelGetSysTimerCount (void) {
+  uint64_t delta;
+  uint64_t count;
+  uint32_t tick;
+
+  if (os_isr_nest == 0) {
+    os_kernel_enter();
+    tick  = os_tick_count;
+    delta = os_host_time() - os_tick_time;
+    os_kernel_exit();
+  } else {
+    tick  = os_tick_count;
+    delta = os_host_time() - os_tick_time;
+  }
+
+  if (delta >= os_host_tick_period()) {
+    delta = os_host_tick_period() - 1U;
+  }
+  count  = (uint64_t)tick * (OS_HOST_SYSTIMER_FREQ / OS_HOST_TICK_FREQ);
+  count += (delta * OS_HOST_SYSTIMER_FREQ) / 1000000000ULL;
+  return (uint32_t)count;
+}
+
+uint32_t osKernelGetSysTimerFreq (void) {
+  return OS_HOST_SYSTIMER_FREQ;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Thread Management
+ *----------------------------------------------------------------------------*/
+
+/* Release thread control block (terminated and detached or joined thread) */
+static void os_thread_free (os_thread_t *thread) {
+
+  if (thread->post_prev != NULL) {
+    thread->post_prev->post_next = thread->post_next;
+  } else {
+    os_post_list = thread->post_next;
+  }
+  if (thread->post_next != NULL) {
+    thread->post_next->post_prev = thread->post_prev;
+  }
+  thread->post_next = NULL;
+  thread->post_prev = NULL;
+  thread->state     = osHostThreadInactive;
+  os_object_free(thread);
+}
+
+/* Terminate thread (kernel critical section) */
+static void os_thread_terminate (os_thread_t *thread) {
+  os_thread_t   *joiner;
+  os_host_ctx_t *ctx = thread->ctx;
+
+  if ((thread->state & osHostThreadStateMask) == osHostThreadReady) {
+    os_thread_list_remove(thread);
+  } else if ((thread->state & osHostThreadStateMask) == osHostThreadBlocked) {
+    os_thread_wait_cancel(thread);
+  }
+
+  os_mutex_owner_release(thread);
+
+  thread->state = osHostThreadTerminated;
+  thread->ctx   = NULL;
+
+  joiner = thread->thread_join;
+  if (joiner != NULL) {
+    thread->thread_join = NULL;
+    os_thread_wait_exit(joiner, (uintptr_t)osOK);
+  }
+  if (((thread->attr & osThreadJoinable) == 0U) || (joiner != NULL)) {
+    os_thread_free(thread);
+  }
+
+  if (ctx != os_host_self) {
+    /* Unwind the host thread of the terminated thread */
+    ctx->exit = 1;
+    (void)sem_post(&ctx->sem);
+  } else {
+    /* Running thread terminated itself: pass the baton and unwind */
+    thread = os_thread_list_get(&os_ready_list);
+    thread->state       = osHostThreadRunning;
+    thread->robin_slice = OS_HOST_ROBIN_TIMEOUT;
+    os_thread_running   = thread;
+    os_host_post(thread->ctx);
+    siglongjmp(ctx->jmp, 1);
+  }
+}
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+  os_thread_t   *thread;
+  os_host_ctx_t *ctx;
+  const char    *name       = NULL;
+  uint32_t       attr_bits  = 0U;
+  void          *cb_mem     = NULL;
+  uint32_t       cb_size    = 0U;
+  void          *stack_mem  = NULL;
+  uint32_t       stack_size = 0U;
+  osPriority_t   priority   = osPriorityNormal;
+  uint8_t        flags;
+
+  if ((os_isr_nest != 0) || (func == NULL)) {
+    return NULL;
+  }
+
+  if (attr != NULL) {
+    name       = attr->name;
+    attr_bits  = attr->attr_bits;
+    cb_mem     = attr->cb_mem;
+    cb_size    = attr->cb_size;
+    stack_mem  = attr->stack_mem;
+    stack_size = attr->stack_size;
+    if (attr->priority != osPriorityNone) {
+      priority = attr->priority;
+    }
+  }
+  if ((priority < osPriorityIdle) || (priority > osPriorityISR)) {
+    return NULL;
+  }
+  if (stack_mem != NULL) {
+    if ((((uintptr_t)stack_mem & 7U) != 0U) || (stack_size < OS_HOST_STACK_MIN) || ((stack_size & 7U) != 0U)) {
+      return NULL;
+    }
+  } else if (stack_size != 0U) {
+    if ((stack_size < OS_HOST_STACK_MIN) || ((stack_size & 7U) != 0U)) {
+      return NULL;
+    }
+  }
+  if (stack_size == 0U) {
+    stack_size = OS_HOST_STACK_SIZE;
+  }
+
+  os_kernel_enter();
+  thread = os_object_alloc(osHostIdThread, cb_mem, cb_size, sizeof(os_thread_t), &flags);
+  if (thread == NULL) {
+    os_kernel_exit();
+    return NULL;
+  }
+  ctx = os_host_ctx_alloc();
+  if (ctx == NULL) {
+    thread->flags = flags;
+    thread->id    = osHostIdThread;
+    os_object_free(thread);
+    os_kernel_exit();
+    return NULL;
+  }
+
+  thread->id            = osHostIdThread;
+  thread->flags         = flags;
+  thread->attr          = (uint8_t)(attr_bits & osThreadJoinable);
+  thread->name          = name;
+  thread->priority      = (int8_t)priority;
+  thread->priority_base = (int8_t)priority;
+  thread->robin_slice   = OS_HOST_ROBIN_TIMEOUT;
+  thread->stack_mem     = stack_mem;
+  thread->stack_size    = stack_size;
+  thread->stack_used    = (stack_size > (2U * OS_HOST_STACK_FRAME)) ? OS_HOST_STACK_FRAME : (stack_size / 2U);
+  thread->func          = func;
+  thread->argument      = argument;
+  thread->ctx           = ctx;
+  ctx->thread           = thread;
+
+  /* Link into the list of all threads */
+  thread->post_next = os_post_list;
+  if (os_post_list != NULL) {
+    os_post_list->post_prev = thread;
+  }
+  os_post_list = thread;
+
+  os_thread_ready_put(thread);
+  os_kernel_exit();
+
+  return thread;
+}
+
+const char *osThreadGetName (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+
+  if (!os_object_valid(thread, osHostIdThread)) {
+    return NULL;
+  }
+  return thread->name;
+}
+
+osThreadId_t osThreadGetId (void) {
+  return os_thread_running;
+}
+
+osThreadState_t osThreadGetState (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+
+  if ((os_isr_nest != 0) || !os_object_valid(thread, osHostIdThread)) {
+    return osThreadError;
+  }
+  return (osThreadState_t)(thread->state & osHostThreadStateMask);
+}
+
+uint32_t osThreadGetStackSize (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+
+  if ((os_isr_nest != 0) || !os_object_valid(thread, osHostIdThread)) {
+    return 0U;
+  }
+  return thread->stack_size;
+}
+
+uint32_t osThreadGetStackSpace (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+
+  if ((os_isr_nest != 0) || !os_object_valid(thread, osHostIdThread)) {
+    return 0U;
+  }
+  return (thread->stack_size - thread->stack_used);
+}
+
+osStatus_t osThreadSetPriority (osThreadId_t thread_id, osPriority_t priority) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(thread, osHostIdThread) || (priority < osPriorityIdle) || (priority > osPriorityISR)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if ((thread->state == osHostThreadInactive) || (thread->state == osHostThreadTerminated)) {
+    os_kernel_exit();
+    return osErrorResource;
+  }
+  if (thread->priority_base != (int8_t)priority) {
+    thread->priority_base = (int8_t)priority;
+    os_thread_priority_update(thread);
+  }
+  os_kernel_exit();
+  return osOK;
+}
+
+osPriority_t osThreadGetPriority (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+
+  if ((os_isr_nest != 0) || !os_object_valid(thread, osHostIdThread)) {
+    return osPriorityError;
+  }
+  if ((thread->state == osHostThreadInactive) || (thread->state == osHostThreadTerminated)) {
+    return osPriorityError;
+  }
+  return (osPriority_t)thread->priority;
+}
+
+osStatus_t osThreadYield (void) {
+  os_thread_t *thread;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  os_kernel_enter();
+  thread = os_thread_running;
+  if ((os_kernel_state == osKernelRunning) && (os_ready_list != NULL) &&
+      (os_ready_list->priority == thread->priority)) {
+    os_robin_yield = 1U;
+  }
+  os_kernel_exit();
+  return osOK;
+}
+
+osStatus_t osThreadSuspend (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status = osOK;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(thread, osHostIdThread)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  switch (thread->state & osHostThreadStateMask) {
+    case osHostThreadRunning:
+      if (os_kernel_state != osKernelRunning) {
+        status = osErrorResource;
+        break;
+      }
+      (void)os_thread_wait_enter(osHostThreadBlocked, NULL, osWaitForever, 0U);
+      break;
+    case osHostThreadReady:
+      os_thread_list_remove(thread);
+      thread->state = osHostThreadBlocked;
+      break;
+    case osHostThreadBlocked:
+      os_thread_wait_cancel(thread);
+      thread->state = osHostThreadBlocked;
+      break;
+    default:
+      status = osErrorResource;
+      break;
+  }
+  os_kernel_exit();
+  return status;
+}
+
+osStatus_t osThreadResume (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status = osOK;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(thread, osHostIdThread)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if ((thread->state & osHostThreadStateMask) != osHostThreadBlocked) {
+    status = osErrorResource;
+  } else {
+    os_thread_wait_cancel(thread);
+    os_thread_ready_put(thread);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+osStatus_t osThreadDetach (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status = osOK;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(thread, osHostIdThread)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if ((thread->attr & osThreadJoinable) == 0U) {
+    status = osErrorResource;
+  } else if (thread->state == osHostThreadTerminated) {
+    os_thread_free(thread);
+  } else {
+    thread->attr &= (uint8_t)~osThreadJoinable;
+  }
+  os_kernel_exit();
+  return status;
+}
+
+osStatus_t osThreadJoin (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(thread, osHostIdThread)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (((thread->attr & osThreadJoinable) == 0U) || (thread == os_thread_running) ||
+      (thread->thread_join != NULL)) {
+    status = osErrorResource;
+  } else if (thread->state == osHostThreadTerminated) {
+    os_thread_free(thread);
+    status = osOK;
+  } else if (!os_thread_wait_allowed()) {
+    status = osErrorResource;
+  } else {
+    thread->thread_join          = os_thread_running;
+    os_thread_running->wait_ptr  = thread;
+    status = (osStatus_t)os_thread_wait_enter(osHostThreadWaitingJoin, NULL, osWaitForever, (uintptr_t)osErrorResource);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+__NO_RETURN void osThreadExit (void) {
+
+  os_kernel_enter();
+  if ((os_isr_nest == 0) && (os_thread_running != NULL) && (os_thread_running->ctx == os_host_self)) {
+    os_thread_terminate(os_thread_running);
+  }
+  /* Not called from an RTOS thread */
+  for (;;) {
+    (void)pause();
+  }
+}
+
+osStatus_t osThreadTerminate (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status = osOK;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(thread, osHostIdThread)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if ((thread->state == osHostThreadInactive) || (thread->state == osHostThreadTerminated)) {
+    status = osErrorResource;
+  } else {
+    os_thread_terminate(thread);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+uint32_t osThreadGetCount (void) {
+  os_thread_t *thread;
+  uint32_t count = 0U;
+
+  if (os_isr_nest != 0) {
+    return 0U;
+  }
+  os_kernel_enter();
+  for (thread = os_post_list; thread != NULL; thread = thread->post_next) {
+    if (thread->state != osHostThreadTerminated) {
+      count++;
+    }
+  }
+  os_kernel_exit();
+  return count;
+}
+
+uint32_t osThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items) {
+  os_thread_t *thread;
+  uint32_t count = 0U;
+
+  if ((os_isr_nest != 0) || (thread_array == NULL) || (array_items == 0U)) {
+    return 0U;
+  }
+  os_kernel_enter();
+  for (thread = os_post_list; (thread != NULL) && (count < array_items); thread = thread->post_next) {
+    if (thread->state != osHostThreadTerminated) {
+      thread_array[count++] = thread;
+    }
+  }
+  os_kernel_exit();
+  return count;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Thread Flags
+ *----------------------------------------------------------------------------*/
+
+/* Check flags against a wait condition and consume them */
+static uint32_t os_flags_check (uint32_t *flags, uint32_t wait_flags, uint32_t options) {
+  uint32_t pattern = *flags;
+
+  if ((options & osFlagsWaitAll) != 0U) {
+    if ((pattern & wait_flags) != wait_flags) {
+      return 0U;
+    }
+  } else {
+    if ((pattern & wait_flags) == 0U) {
+      return 0U;
+    }
+  }
+  if ((options & osFlagsNoClear) == 0U) {
+    *flags = pattern & ~wait_flags;
+  }
+  return pattern;
+}
+
+uint32_t osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  uint32_t thread_flags, flags0;
+
+  if (!os_object_valid(thread, osHostIdThread) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  os_kernel_enter();
+  if ((thread->state == osHostThreadInactive) || (thread->state == osHostThreadTerminated)) {
+    os_kernel_exit();
+    return osFlagsErrorParameter;
+  }
+  thread->thread_flags |= flags;
+  thread_flags = thread->thread_flags;
+
+  if (thread->state == osHostThreadWaitingThreadFlags) {
+    flags0 = os_flags_check(&thread->thread_flags, thread->wait_flags, thread->flags_options);
+    if (flags0 != 0U) {
+      thread_flags = thread->thread_flags;
+      os_thread_wait_exit(thread, flags0);
+    }
+  }
+  os_kernel_exit();
+  return thread_flags;
+}
+
+uint32_t osThreadFlagsClear (uint32_t flags) {
+  os_thread_t *thread;
+  uint32_t thread_flags;
+
+  if (os_isr_nest != 0) {
+    return osFlagsErrorISR;
+  }
+  if ((flags & osFlagsError) != 0U) {
+    return osFlagsErrorParameter;
+  }
+  os_kernel_enter();
+  thread = os_thread_running;
+  if (thread == NULL) {
+    os_kernel_exit();
+    return osFlagsErrorUnknown;
+  }
+  thread_flags = thread->thread_flags;
+  thread->thread_flags &= ~flags;
+  os_kernel_exit();
+  return thread_flags;
+}
+
+uint32_t osThreadFlagsGet (void) {
+  os_thread_t *thread = os_thread_running;
+
+  if ((os_isr_nest != 0) || (thread == NULL)) {
+    return 0U;
+  }
+  return thread->thread_flags;
+}
+
+uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout) {
+  os_thread_t *thread;
+  uint32_t thread_flags;
+
+  if (os_isr_nest != 0) {
+    return osFlagsErrorISR;
+  }
+  if ((flags & osFlagsError) != 0U) {
+    return osFlagsErrorParameter;
+  }
+  os_kernel_enter();
+  thread = os_thread_running;
+  thread_flags = os_flags_check(&thread->thread_flags, flags, options);
+  if (thread_flags == 0U) {
+    if (timeout == 0U) {
+      thread_flags = osFlagsErrorResource;
+    } else {
+      thread->wait_flags    = flags;
+      thread->flags_options = options;
+      thread_flags = (uint32_t)os_thread_wait_enter(osHostThreadWaitingThreadFlags, NULL, timeout, osFlagsErrorTimeout);
+    }
+  }
+  os_kernel_exit();
+  return thread_flags;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Generic Wait Functions
+ *----------------------------------------------------------------------------*/
+
+osStatus_t osDelay (uint32_t ticks) {
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (ticks != 0U) {
+    os_kernel_enter();
+    (void)os_thread_wait_enter(osHostThreadWaitingDelay, NULL, ticks, (uintptr_t)osOK);
+    os_kernel_exit();
+  }
+  return osOK;
+}
+
+osStatus_t osDelayUntil (uint32_t ticks) {
+  osStatus_t status = osOK;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  os_kernel_enter();
+  ticks -= os_tick_count;
+  if ((ticks == 0U) || (ticks > 0x7FFFFFFFU)) {
+    status = osErrorParameter;
+  } else {
+    (void)os_thread_wait_enter(osHostThreadWaitingDelay, NULL, ticks, (uintptr_t)osOK);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Timer Management
+ *----------------------------------------------------------------------------*/
+
+osTimerId_t osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument, const osTimerAttr_t *attr) {
+  os_timer_t *timer;
+  uint8_t     flags;
+
+  if ((os_isr_nest != 0) || (func == NULL) || ((type != osTimerOnce) && (type != osTimerPeriodic))) {
+    return NULL;
+  }
+  os_kernel_enter();
+  timer = os_object_alloc(osHostIdTimer, (attr != NULL) ? attr->cb_mem : NULL,
+                                         (attr != NULL) ? attr->cb_size : 0U, sizeof(os_timer_t), &flags);
+  if (timer != NULL) {
+    timer->id       = osHostIdTimer;
+    timer->state    = OS_HOST_TIMER_STOPPED;
+    timer->flags    = flags;
+    timer->type     = (uint8_t)type;
+    timer->name     = (attr != NULL) ? attr->name : NULL;
+    timer->func     = func;
+    timer->argument = argument;
+  }
+  os_kernel_exit();
+  return timer;
+}
+
+const char *osTimerGetName (osTimerId_t timer_id) {
+  os_timer_t *timer = (os_timer_t *)timer_id;
+
+  if (!os_object_valid(timer, osHostIdTimer)) {
+    return NULL;
+  }
+  return timer->name;
+}
+
+osStatus_t osTimerStart (osTimerId_t timer_id, uint32_t ticks) {
+  os_timer_t *timer = (os_timer_t *)timer_id;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(timer, osHostIdTimer) || (ticks == 0U)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (timer->state == OS_HOST_TIMER_RUNNING) {
+    os_timer_remove(timer);
+  } else {
+    timer->state = OS_HOST_TIMER_RUNNING;
+  }
+  timer->load = ticks;
+  os_timer_insert(timer, os_tick_count + ticks);
+  os_kernel_exit();
+  return osOK;
+}
+
+osStatus_t osTimerStop (osTimerId_t timer_id) {
+  os_timer_t *timer = (os_timer_t *)timer_id;
+  osStatus_t  status = osOK;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(timer, osHostIdTimer)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (timer->state != OS_HOST_TIMER_RUNNING) {
+    status = osErrorResource;
+  } else {
+    timer->state = OS_HOST_TIMER_STOPPED;
+    os_timer_remove(timer);
+    os_timer_unqueue(timer);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+uint32_t osTimerIsRunning (osTimerId_t timer_id) {
+  os_timer_t *timer = (os_timer_t *)timer_id;
+
+  if ((os_isr_nest != 0) || !os_object_valid(timer, osHostIdTimer)) {
+    return 0U;
+  }
+  return (timer->state == OS_HOST_TIMER_RUNNING) ? 1U : 0U;
+}
+
+osStatus_t osTimerDelete (osTimerId_t timer_id) {
+  os_timer_t *timer = (os_timer_t *)timer_id;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(timer, osHostIdTimer)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (timer->state == OS_HOST_TIMER_RUNNING) {
+    os_timer_remove(timer);
+  }
+  os_timer_unqueue(timer);
+  timer->state = OS_HOST_TIMER_INACTIVE;
+  os_object_free(timer);
+  os_kernel_exit();
+  return osOK;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Event Flags
+ *----------------------------------------------------------------------------*/
+
+osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr) {
+  os_event_flags_t *ef;
+  uint8_t flags;
+
+  if (os_isr_nest != 0) {
+    return NULL;
+  }
+  os_kernel_enter();
+  ef = os_object_alloc(osHostIdEventFlags, (attr != NULL) ? attr->cb_mem : NULL,
+                                           (attr != NULL) ? attr->cb_size : 0U, sizeof(os_event_flags_t), &flags);
+  if (ef != NULL) {
+    ef->id    = osHostIdEventFlags;
+    ef->flags = flags;
+    ef->name  = (attr != NULL) ? attr->name : NULL;
+  }
+  os_kernel_exit();
+  return ef;
+}
+
+const char *osEventFlagsGetName (osEventFlagsId_t ef_id) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+
+  if (!os_object_valid(ef, osHostIdEventFlags)) {
+    return NULL;
+  }
+  return ef->name;
+}
+
+uint32_t osEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  os_thread_t *thread, *thread_next;
+  uint32_t event_flags, flags0;
+
+  if (!os_object_valid(ef, osHostIdEventFlags) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  os_kernel_enter();
+  ef->event_flags |= flags;
+  event_flags = ef->event_flags;
+
+  for (thread = ef->thread_list; thread != NULL; thread = thread_next) {
+    thread_next = thread->thread_next;
+    flags0 = os_flags_check(&ef->event_flags, thread->wait_flags, thread->flags_options);
+    if (flags0 != 0U) {
+      event_flags = ef->event_flags;
+      os_thread_wait_exit(thread, flags0);
+    }
+  }
+  os_kernel_exit();
+  return event_flags;
+}
+
+uint32_t osEventFlagsClear (osEventFlagsId_t ef_id, uint32_t flags) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  uint32_t event_flags;
+
+  if (!os_object_valid(ef, osHostIdEventFlags) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  os_kernel_enter();
+  event_flags = ef->event_flags;
+  ef->event_flags &= ~flags;
+  os_kernel_exit();
+  return event_flags;
+}
+
+uint32_t osEventFlagsGet (osEventFlagsId_t ef_id) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+
+  if (!os_object_valid(ef, osHostIdEventFlags)) {
+    return 0U;
+  }
+  return ef->event_flags;
+}
+
+uint32_t osEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  os_thread_t *thread;
+  uint32_t event_flags;
+
+  if (!os_object_valid(ef, osHostIdEventFlags) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  if ((os_isr_nest != 0) && (timeout != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  os_kernel_enter();
+  event_flags = os_flags_check(&ef->event_flags, flags, options);
+  if (event_flags == 0U) {
+    if (timeout == 0U) {
+      event_flags = osFlagsErrorResource;
+    } else {
+      thread = os_thread_running;
+      thread->wait_flags    = flags;
+      thread->flags_options = options;
+      event_flags = (uint32_t)os_thread_wait_enter(osHostThreadWaitingEventFlags, &ef->thread_list, timeout, osFlagsErrorTimeout);
+    }
+  }
+  os_kernel_exit();
+  return event_flags;
+}
+
+osStatus_t osEventFlagsDelete (osEventFlagsId_t ef_id) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  os_thread_t *thread;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(ef, osHostIdEventFlags)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  while ((thread = ef->thread_list) != NULL) {
+    os_thread_wait_exit(thread, osFlagsErrorResource);
+  }
+  os_object_free(ef);
+  os_kernel_exit();
+  return osOK;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Mutex Management
+ *----------------------------------------------------------------------------*/
+
+/* Link mutex into the list of mutexes owned by thread */
+static void os_mutex_owner_link (os_mutex_t *mutex, os_thread_t *thread) {
+  mutex->owner_thread = thread;
+  mutex->owner_prev   = NULL;
+  mutex->owner_next   = thread->mutex_list;
+  if (thread->mutex_list != NULL) {
+    thread->mutex_list->owner_prev = mutex;
+  }
+  thread->mutex_list = mutex;
+  mutex->lock = 1U;
+}
+
+/* Unlink mutex from the list of mutexes owned by its owner */
+static void os_mutex_owner_unlink (os_mutex_t *mutex) {
+
+  if ((mutex->state & OS_HOST_MUTEX_ORPHANED) == 0U) {
+    if (mutex->owner_prev != NULL) {
+      mutex->owner_prev->owner_next = mutex->owner_next;
+    } else {
+      mutex->owner_thread->mutex_list = mutex->owner_next;
+    }
+    if (mutex->owner_next != NULL) {
+      mutex->owner_next->owner_prev = mutex->owner_prev;
+    }
+  }
+  mutex->state       &= (uint8_t)~OS_HOST_MUTEX_ORPHANED;
+  mutex->owner_thread = NULL;
+  mutex->owner_prev   = NULL;
+  mutex->owner_next   = NULL;
+  mutex->lock         = 0U;
+}
+
+/* Pass mutex to the highest priority waiting thread */
+static void os_mutex_handover (os_mutex_t *mutex) {
+  os_thread_t *thread = mutex->thread_list;
+
+  if (thread != NULL) {
+    os_thread_wait_exit(thread, (uintptr_t)osOK);
+    os_mutex_owner_link(mutex, thread);
+    os_thread_priority_update(thread);
+  }
+}
+
+/* Release mutexes owned by a terminating thread */
+static void os_mutex_owner_release (os_thread_t *thread) {
+  os_mutex_t *mutex, *mutex_next;
+
+  for (mutex = thread->mutex_list; mutex != NULL; mutex = mutex_next) {
+    mutex_next = mutex->owner_next;
+    if ((mutex->attr & osMutexRobust) != 0U) {
+      mutex->state |= OS_HOST_MUTEX_ORPHANED;
+      os_mutex_owner_unlink(mutex);
+      os_mutex_handover(mutex);
+    } else {
+      /* Non-robust mutex stays locked by the terminated thread */
+      mutex->state     |= OS_HOST_MUTEX_ORPHANED;
+      mutex->owner_prev = NULL;
+      mutex->owner_next = NULL;
+    }
+  }
+  thread->mutex_list = NULL;
+}
+
+osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
+  os_mutex_t *mutex;
+  uint8_t flags;
+
+  if (os_isr_nest != 0) {
+    return NULL;
+  }
+  os_kernel_enter();
+  mutex = os_object_alloc(osHostIdMutex, (attr != NULL) ? attr->cb_mem : NULL,
+                                         (attr != NULL) ? attr->cb_size : 0U, sizeof(os_mutex_t), &flags);
+  if (mutex != NULL) {
+    mutex->id    = osHostIdMutex;
+    mutex->flags = flags;
+    mutex->attr  = (attr != NULL) ? (uint8_t)attr->attr_bits : 0U;
+    mutex->name  = (attr != NULL) ? attr->name : NULL;
+  }
+  os_kernel_exit();
+  return mutex;
+}
+
+const char *osMutexGetName (osMutexId_t mutex_id) {
+  os_mutex_t *mutex = (os_mutex_t *)mutex_id;
+
+  if (!os_object_valid(mutex, osHostIdMutex)) {
+    return NULL;
+  }
+  return mutex->name;
+}
+
+osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
+  os_mutex_t  *mutex = (os_mutex_t *)mutex_id;
+  os_thread_t *thread;
+  osStatus_t   status = osOK;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(mutex, osHostIdMutex)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  thread = os_thread_running;
+  if (mutex->lock == 0U) {
+    os_mutex_owner_link(mutex, thread);
+  } else if ((mutex->owner_thread == thread) && ((mutex->state & OS_HOST_MUTEX_ORPHANED) == 0U)) {
+    if (((mutex->attr & osMutexRecursive) == 0U) || (mutex->lock == OS_HOST_MUTEX_LOCK_LIMIT)) {
+      status = osErrorResource;
+    } else {
+      mutex->lock++;
+    }
+  } else if (timeout == 0U) {
+    status = osErrorResource;
+  } else if (!os_thread_wait_allowed()) {
+    status = osErrorTimeout;
+  } else {
+    thread->wait_ptr = mutex;
+    if (((mutex->attr & osMutexPrioInherit) != 0U) && ((mutex->state & OS_HOST_MUTEX_ORPHANED) == 0U)) {
+      /* Owner inherits the priority once the thread is queued */
+      thread->state = osHostThreadWaitingMutex;
+      os_thread_list_put(&mutex->thread_list, thread);
+      os_thread_priority_update(mutex->owner_thread);
+      os_thread_list_remove(thread);
+    }
+    status = (osStatus_t)os_thread_wait_enter(osHostThreadWaitingMutex, &mutex->thread_list, timeout, (uintptr_t)osErrorTimeout);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+osStatus_t osMutexRelease (osMutexId_t mutex_id) {
+  os_mutex_t  *mutex = (os_mutex_t *)mutex_id;
+  os_thread_t *thread;
+  osStatus_t   status = osOK;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(mutex, osHostIdMutex)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  thread = os_thread_running;
+  if ((mutex->lock == 0U) || (mutex->owner_thread != thread) || ((mutex->state & OS_HOST_MUTEX_ORPHANED) != 0U)) {
+    status = osErrorResource;
+  } else {
+    mutex->lock--;
+    if (mutex->lock == 0U) {
+      os_mutex_owner_unlink(mutex);
+      os_thread_priority_update(thread);
+      os_mutex_handover(mutex);
+    }
+  }
+  os_kernel_exit();
+  return status;
+}
+
+osThreadId_t osMutexGetOwner (osMutexId_t mutex_id) {
+  os_mutex_t *mutex = (os_mutex_t *)mutex_id;
+
+  if ((os_isr_nest != 0) || !os_object_valid(mutex, osHostIdMutex) || (mutex->lock == 0U)) {
+    return NULL;
+  }
+  return mutex->owner_thread;
+}
+
+osStatus_t osMutexDelete (osMutexId_t mutex_id) {
+  os_mutex_t  *mutex = (os_mutex_t *)mutex_id;
+  os_thread_t *thread, *owner;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(mutex, osHostIdMutex)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (mutex->lock != 0U) {
+    owner = ((mutex->state & OS_HOST_MUTEX_ORPHANED) == 0U) ? mutex->owner_thread : NULL;
+    os_mutex_owner_unlink(mutex);
+    while ((thread = mutex->thread_list) != NULL) {
+      os_thread_wait_exit(thread, (uintptr_t)osErrorResource);
+    }
+    if (owner != NULL) {
+      os_thread_priority_update(owner);
+    }
+  }
+  os_object_free(mutex);
+  os_kernel_exit();
+  return osOK;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Semaphores
+ *----------------------------------------------------------------------------*/
+
+osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr) {
+  os_semaphore_t *semaphore;
+  uint8_t flags;
+
+  if ((os_isr_nest != 0) || (max_count == 0U) || (max_count > OS_HOST_SEMAPHORE_TOKEN_LIMIT) ||
+      (initial_count > max_count)) {
+    return NULL;
+  }
+  os_kernel_enter();
+  semaphore = os_object_alloc(osHostIdSemaphore, (attr != NULL) ? attr->cb_mem : NULL,
+                                                 (attr != NULL) ? attr->cb_size : 0U, sizeof(os_semaphore_t), &flags);
+  if (semaphore != NULL) {
+    semaphore->id         = osHostIdSemaphore;
+    semaphore->flags      = flags;
+    semaphore->name       = (attr != NULL) ? attr->name : NULL;
+    semaphore->tokens     = initial_count;
+    semaphore->max_tokens = max_count;
+  }
+  os_kernel_exit();
+  return semaphore;
+}
+
+const char *osSemaphoreGetName (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *semaphore = (os_semaphore_t *)semaphore_id;
+
+  if (!os_object_valid(semaphore, osHostIdSemaphore)) {
+    return NULL;
+  }
+  return semaphore->name;
+}
+
+osStatus_t osSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout) {
+  os_semaphore_t *semaphore = (os_semaphore_t *)semaphore_id;
+  osStatus_t status = osOK;
+
+  if (!os_object_valid(semaphore, osHostIdSemaphore)) {
+    return osErrorParameter;
+  }
+  if ((os_isr_nest != 0) && (timeout != 0U)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (semaphore->tokens != 0U) {
+    semaphore->tokens--;
+  } else if (timeout == 0U) {
+    status = osErrorResource;
+  } else {
+    status = (osStatus_t)os_thread_wait_enter(osHostThreadWaitingSemaphore, &semaphore->thread_list, timeout, (uintptr_t)osErrorTimeout);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+osStatus_t osSemaphoreRelease (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *semaphore = (os_semaphore_t *)semaphore_id;
+  osStatus_t status = osOK;
+
+  if (!os_object_valid(semaphore, osHostIdSemaphore)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (semaphore->thread_list != NULL) {
+    os_thread_wait_exit(semaphore->thread_list, (uintptr_t)osOK);
+  } else if (semaphore->tokens < semaphore->max_tokens) {
+    semaphore->tokens++;
+  } else {
+    status = osErrorResource;
+  }
+  os_kernel_exit();
+  return status;
+}
+
+uint32_t osSemaphoreGetCount (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *semaphore = (os_semaphore_t *)semaphore_id;
+
+  if (!os_object_valid(semaphore, osHostIdSemaphore)) {
+    return 0U;
+  }
+  return semaphore->tokens;
+}
+
+osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *semaphore = (os_semaphore_t *)semaphore_id;
+  os_thread_t *thread;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(semaphore, osHostIdSemaphore)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  while ((thread = semaphore->thread_list) != NULL) {
+    os_thread_wait_exit(thread, (uintptr_t)osErrorResource);
+  }
+  os_object_free(semaphore);
+  os_kernel_exit();
+  return osOK;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Memory Pool
+ *----------------------------------------------------------------------------*/
+
+osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, const osMemoryPoolAttr_t *attr) {
+  os_memory_pool_t *mp;
+  void    *mp_mem  = NULL;
+  uint32_t mp_size = 0U;
+  uint32_t size, stride, n;
+  uint8_t *block;
+  uint8_t  flags;
+
+  if ((os_isr_nest != 0) || (block_count == 0U) || (block_size == 0U)) {
+    return NULL;
+  }
+  stride = (block_size + 7U) & ~7U;
+  size   = osHostMemoryPoolMemSize(block_count, block_size);
+  if ((size / stride) != block_count) {
+    return NULL;
+  }
+  if (attr != NULL) {
+    mp_mem  = attr->mp_mem;
+    mp_size = attr->mp_size;
+  }
+  if (mp_mem != NULL) {
+    if ((((uintptr_t)mp_mem & 3U) != 0U) || (mp_size < size)) {
+      return NULL;
+    }
+  } else if (mp_size != 0U) {
+    return NULL;
+  }
+
+  os_kernel_enter();
+  mp = os_object_alloc(osHostIdMemoryPool, (attr != NULL) ? attr->cb_mem : NULL,
+                                           (attr != NULL) ? attr->cb_size : 0U, sizeof(os_memory_pool_t), &flags);
+  if (mp != NULL) {
+    if (mp_mem == NULL) {
+      mp_mem = malloc(size);
+      if (mp_mem == NULL) {
+        mp->flags = flags;
+        mp->id    = osHostIdMemoryPool;
+        os_object_free(mp);
+        os_kernel_exit();
+        return NULL;
+      }
+      flags |= osHostFlagSystemMemory;
+    }
+    mp->id          = osHostIdMemoryPool;
+    mp->flags       = flags;
+    mp->name        = (attr != NULL) ? attr->name : NULL;
+    mp->block_base  = mp_mem;
+    mp->block_lim   = (uint8_t *)mp_mem + size;
+    mp->max_blocks  = block_count;
+    mp->used_blocks = 0U;
+    mp->block_size  = block_size;
+
+    /* Link free blocks */
+    block = (uint8_t *)mp_mem;
+    for (n = 0U; n < block_count; n++) {
+      void *next = (n < (block_count - 1U)) ? (block + stride) : NULL;
+      memcpy(block, &next, sizeof(void *));
+      block += stride;
+    }
+    mp->block_free = mp_mem;
+  }
+  os_kernel_exit();
+  return mp;
+}
+
+const char *osMemoryPoolGetName (osMemoryPoolId_t mp_id) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+
+  if (!os_object_valid(mp, osHostIdMemoryPool)) {
+    return NULL;
+  }
+  return mp->name;
+}
+
+void *osMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+  void *block;
+
+  if (!os_object_valid(mp, osHostIdMemoryPool)) {
+    return NULL;
+  }
+  if ((os_isr_nest != 0) && (timeout != 0U)) {
+    return NULL;
+  }
+  os_kernel_enter();
+  block = mp->block_free;
+  if (block != NULL) {
+    memcpy(&mp->block_free, block, sizeof(void *));
+    mp->used_blocks++;
+  } else if (timeout != 0U) {
+    block = (void *)os_thread_wait_enter(osHostThreadWaitingMemoryPool, &mp->thread_list, timeout, 0U);
+  }
+  os_kernel_exit();
+  return block;
+}
+
+osStatus_t osMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+  uint32_t stride;
+
+  if (!os_object_valid(mp, osHostIdMemoryPool)) {
+    return osErrorParameter;
+  }
+  stride = (mp->block_size + 7U) & ~7U;
+  if (((uint8_t *)block < (uint8_t *)mp->block_base) || ((uint8_t *)block >= (uint8_t *)mp->block_lim) ||
+      ((((uint8_t *)block - (uint8_t *)mp->block_base) % stride) != 0U)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (mp->used_blocks == 0U) {
+    os_kernel_exit();
+    return osErrorResource;
+  }
+  if (mp->thread_list != NULL) {
+    /* Pass block to the waiting thread */
+    os_thread_wait_exit(mp->thread_list, (uintptr_t)block);
+  } else {
+    memcpy(block, &mp->block_free, sizeof(void *));
+    mp->block_free = block;
+    mp->used_blocks--;
+  }
+  os_kernel_exit();
+  return osOK;
+}
+
+uint32_t osMemoryPoolGetCapacity (osMemoryPoolId_t mp_id) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+
+  if (!os_object_valid(mp, osHostIdMemoryPool)) {
+    return 0U;
+  }
+  return mp->max_blocks;
+}
+
+uint32_t osMemoryPoolGetBlockSize (osMemoryPoolId_t mp_id) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+
+  if (!os_object_valid(mp, osHostIdMemoryPool)) {
+    return 0U;
+  }
+  return mp->block_size;
+}
+
+uint32_t osMemoryPoolGetCount (osMemoryPoolId_t mp_id) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+
+  if (!os_object_valid(mp, osHostIdMemoryPool)) {
+    return 0U;
+  }
+  return mp->used_blocks;
+}
+
+uint32_t osMemoryPoolGetSpace (osMemoryPoolId_t mp_id) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+
+  if (!os_object_valid(mp, osHostIdMemoryPool)) {
+    return 0U;
+  }
+  return (mp->max_blocks - mp->used_blocks);
+}
+
+osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+  os_thread_t *thread;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(mp, osHostIdMemoryPool)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  while ((thread = mp->thread_list) != NULL) {
+    os_thread_wait_exit(thread, 0U);
+  }
+  if ((mp->flags & osHostFlagSystemMemory) != 0U) {
+    free(mp->block_base);
+  }
+  mp->block_base = NULL;
+  mp->block_lim  = NULL;
+  mp->block_free = NULL;
+  os_object_free(mp);
+  os_kernel_exit();
+  return osOK;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Message Queue
+ *----------------------------------------------------------------------------*/
+
+/* Message slot (message data followed by the priority byte) */
+static uint8_t *os_message_slot (os_message_queue_t *mq, uint32_t n) {
+  uint32_t stride = (mq->msg_size + 1U + 7U) & ~7U;
+
+  return (mq->buf + (((mq->msg_head + n) % mq->msg_count) * stride));
+}
+
+/* Insert message in priority order (FIFO within the same priority) */
+static void os_message_put (os_message_queue_t *mq, const void *msg, uint8_t prio) {
+  uint8_t *slot, *prev;
+  uint32_t n = mq->msg_used;
+
+  while (n != 0U) {
+    prev = os_message_slot(mq, n - 1U);
+    if (prev[mq->msg_size] >= prio) {
+      break;
+    }
+    memcpy(os_message_slot(mq, n), prev, mq->msg_size + 1U);
+    n--;
+  }
+  slot = os_message_slot(mq, n);
+  memcpy(slot, msg, mq->msg_size);
+  slot[mq->msg_size] = prio;
+  mq->msg_used++;
+}
+
+/* Remove the first message */
+static void os_message_get (os_message_queue_t *mq, void *msg, uint8_t *prio) {
+  uint8_t *slot = os_message_slot(mq, 0U);
+
+  memcpy(msg, slot, mq->msg_size);
+  if (prio != NULL) {
+    *prio = slot[mq->msg_size];
+  }
+  mq->msg_head = (mq->msg_head + 1U) % mq->msg_count;
+  mq->msg_used--;
+}
+
+/* Move the message of the first waiting sender into the queue */
+static void os_message_put_waiting (os_message_queue_t *mq) {
+  os_thread_t       *thread = mq->thread_list;
+  os_message_wait_t *wait;
+
+  if ((thread != NULL) && (thread->state == osHostThreadWaitingMessagePut) && (mq->msg_used < mq->msg_count)) {
+    wait = (os_message_wait_t *)thread->wait_ptr;
+    os_message_put(mq, wait->msg, *wait->prio);
+    os_thread_wait_exit(thread, (uintptr_t)osOK);
+  }
+}
+
+osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
+  os_message_queue_t *mq;
+  void    *mq_mem  = NULL;
+  uint32_t mq_size = 0U;
+  uint32_t size, stride;
+  uint8_t  flags;
+
+  if ((os_isr_nest != 0) || (msg_count == 0U) || (msg_size == 0U)) {
+    return NULL;
+  }
+  stride = (msg_size + 1U + 7U) & ~7U;
+  size   = osHostMessageQueueMemSize(msg_count, msg_size);
+  if ((stride <= msg_size) || ((size / stride) != msg_count)) {
+    return NULL;
+  }
+  if (attr != NULL) {
+    mq_mem  = attr->mq_mem;
+    mq_size = attr->mq_size;
+  }
+  if (mq_mem != NULL) {
+    if ((((uintptr_t)mq_mem & 3U) != 0U) || (mq_size < size)) {
+      return NULL;
+    }
+  } else if (mq_size != 0U) {
+    return NULL;
+  }
+
+  os_kernel_enter();
+  mq = os_object_alloc(osHostIdMessageQueue, (attr != NULL) ? attr->cb_mem : NULL,
+                                             (attr != NULL) ? attr->cb_size : 0U, sizeof(os_message_queue_t), &flags);
+  if (mq != NULL) {
+    if (mq_mem == NULL) {
+      mq_mem = malloc(size);
+      if (mq_mem == NULL) {
+        mq->flags = flags;
+        mq->id    = osHostIdMessageQueue;
+        os_object_free(mq);
+        os_kernel_exit();
+        return NULL;
+      }
+      flags |= osHostFlagSystemMemory;
+    }
+    mq->id        = osHostIdMessageQueue;
+    mq->flags     = flags;
+    mq->name      = (attr != NULL) ? attr->name : NULL;
+    mq->buf       = (uint8_t *)mq_mem;
+    mq->msg_count = msg_count;
+    mq->msg_size  = msg_size;
+  }
+  os_kernel_exit();
+  return mq;
+}
+
+const char *osMessageQueueGetName (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+
+  if (!os_object_valid(mq, osHostIdMessageQueue)) {
+    return NULL;
+  }
+  return mq->name;
+}
+
+osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_message_wait_t  *wait;
+  os_message_wait_t   put;
+  os_thread_t        *thread;
+  osStatus_t status = osOK;
+
+  if (!os_object_valid(mq, osHostIdMessageQueue) || (msg_ptr == NULL)) {
+    return osErrorParameter;
+  }
+  if ((os_isr_nest != 0) && (timeout != 0U)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  thread = mq->thread_list;
+  if ((thread != NULL) && (thread->state == osHostThreadWaitingMessageGet)) {
+    /* Pass message directly to the waiting receiver */
+    wait = (os_message_wait_t *)thread->wait_ptr;
+    memcpy(wait->msg, msg_ptr, mq->msg_size);
+    if (wait->prio != NULL) {
+      *wait->prio = msg_prio;
+    }
+    os_thread_wait_exit(thread, (uintptr_t)osOK);
+  } else if (mq->msg_used < mq->msg_count) {
+    os_message_put(mq, msg_ptr, msg_prio);
+  } else if (timeout == 0U) {
+    status = osErrorResource;
+  } else {
+    put.msg  = (void *)(uintptr_t)msg_ptr;
+    put.prio = &msg_prio;
+    os_thread_running->wait_ptr = &put;
+    status = (osStatus_t)os_thread_wait_enter(osHostThreadWaitingMessagePut, &mq->thread_list, timeout, (uintptr_t)osErrorTimeout);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_message_wait_t   get;
+  osStatus_t status = osOK;
+
+  if (!os_object_valid(mq, osHostIdMessageQueue) || (msg_ptr == NULL)) {
+    return osErrorParameter;
+  }
+  if ((os_isr_nest != 0) && (timeout != 0U)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  if (mq->msg_used != 0U) {
+    os_message_get(mq, msg_ptr, msg_prio);
+    os_message_put_waiting(mq);
+  } else if (timeout == 0U) {
+    status = osErrorResource;
+  } else {
+    get.msg  = msg_ptr;
+    get.prio = msg_prio;
+    os_thread_running->wait_ptr = &get;
+    status = (osStatus_t)os_thread_wait_enter(osHostThreadWaitingMessageGet, &mq->thread_list, timeout, (uintptr_t)osErrorTimeout);
+  }
+  os_kernel_exit();
+  return status;
+}
+
+uint32_t osMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+
+  if (!os_object_valid(mq, osHostIdMessageQueue)) {
+    return 0U;
+  }
+  return mq->msg_count;
+}
+
+uint32_t osMessageQueueGetMsgSize (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+
+  if (!os_object_valid(mq, osHostIdMessageQueue)) {
+    return 0U;
+  }
+  return mq->msg_size;
+}
+
+uint32_t osMessageQueueGetCount (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+
+  if (!os_object_valid(mq, osHostIdMessageQueue)) {
+    return 0U;
+  }
+  return mq->msg_used;
+}
+
+uint32_t osMessageQueueGetSpace (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+
+  if (!os_object_valid(mq, osHostIdMessageQueue)) {
+    return 0U;
+  }
+  return (mq->msg_count - mq->msg_used);
+}
+
+osStatus_t osMessageQueueReset (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(mq, osHostIdMessageQueue)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  mq->msg_used = 0U;
+  mq->msg_head = 0U;
+  while ((mq->thread_list != NULL) && (mq->thread_list->state == osHostThreadWaitingMessagePut) &&
+         (mq->msg_used < mq->msg_count)) {
+    os_message_put_waiting(mq);
+  }
+  os_kernel_exit();
+  return osOK;
+}
+
+osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_thread_t *thread;
+
+  if (os_isr_nest != 0) {
+    return osErrorISR;
+  }
+  if (!os_object_valid(mq, osHostIdMessageQueue)) {
+    return osErrorParameter;
+  }
+  os_kernel_enter();
+  while ((thread = mq->thread_list) != NULL) {
+    os_thread_wait_exit(thread, (uintptr_t)osErrorResource);
+  }
+  if ((mq->flags & osHostFlagSystemMemory) != 0U) {
+    free(mq->buf);
+  }
+  mq->buf = NULL;
+  os_object_free(mq);
+  os_kernel_exit();
+  return osOK;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Emulated interrupt controller
+ *----------------------------------------------------------------------------*/
+
+/* Check interrupt number */
+static uint32_t os_irq_valid (IRQn_ID_t irqn) {
+  return ((irqn >= 0) && (irqn < IRQ_HOST_NUM));
+}
+
+/* Deliver pending interrupts to the calling thread */
+static void os_irq_trigger (void) {
+  uint32_t pend = __atomic_load_n(&os_irq_pend, __ATOMIC_SEQ_CST) & os_irq_enable;
+
+  if ((pend != 0U) && os_host_thread_mode()) {
+    (void)pthread_kill(pthread_self(), OS_HOST_SIG_IRQ);
+  }
+}
+
+int32_t IRQ_Initialize (void) {
+  os_irq_enable = 0U;
+  __atomic_and_fetch(&os_irq_pend, OS_HOST_PEND_TICK, __ATOMIC_SEQ_CST);
+  memset(os_irq_handler, 0, sizeof(os_irq_handler));
+  return 0;
+}
+
+int32_t IRQ_SetHandler (IRQn_ID_t irqn, IRQHandler_t handler) {
+  if (!os_irq_valid(irqn)) {
+    return -1;
+  }
+  os_irq_handler[irqn] = handler;
+  return 0;
+}
+
+IRQHandler_t IRQ_GetHandler (IRQn_ID_t irqn) {
+  if (!os_irq_valid(irqn)) {
+    return NULL;
+  }
+  return os_irq_handler[irqn];
+}
+
+int32_t IRQ_Enable (IRQn_ID_t irqn) {
+  if (!os_irq_valid(irqn)) {
+    return -1;
+  }
+  __atomic_or_fetch(&os_irq_enable, 1UL << irqn, __ATOMIC_SEQ_CST);
+  os_irq_trigger();
+  return 0;
+}
+
+int32_t IRQ_Disable (IRQn_ID_t irqn) {
+  if (!os_irq_valid(irqn)) {
+    return -1;
+  }
+  __atomic_and_fetch(&os_irq_enable, ~(1UL << irqn), __ATOMIC_SEQ_CST);
+  return 0;
+}
+
+uint32_t IRQ_GetEnableState (IRQn_ID_t irqn) {
+  if (!os_irq_valid(irqn)) {
+    return 0U;
+  }
+  return ((os_irq_enable >> irqn) & 1U);
+}
+
+int32_t IRQ_SetMode (IRQn_ID_t irqn, uint32_t mode) {
+  if (!os_irq_valid(irqn) || (mode > IRQ_MODE_TRIG_EDGE)) {
+    return -1;
+  }
+  if (mode == IRQ_MODE_TRIG_EDGE) {
+    os_irq_mode |=  (1UL << irqn);
+  } else {
+    os_irq_mode &= ~(1UL << irqn);
+  }
+  return 0;
+}
+
+uint32_t IRQ_GetMode (IRQn_ID_t irqn) {
+  if (!os_irq_valid(irqn)) {
+    return IRQ_MODE_ERROR;
+  }
+  return ((os_irq_mode >> irqn) & 1U);
+}
+
+int32_t IRQ_SetPending (IRQn_ID_t irqn) {
+  if (!os_irq_valid(irqn)) {
+    return -1;
+  }
+  __atomic_or_fetch(&os_irq_pend, 1UL << irqn, __ATOMIC_SEQ_CST);
+  os_irq_trigger();
+  return 0;
+}
+
+uint32_t IRQ_GetPending (IRQn_ID_t irqn) {
+  if (!os_irq_valid(irqn)) {
+    return 0U;
+  }
+  return ((__atomic_load_n(&os_irq_pend, __ATOMIC_SEQ_CST) >> irqn) & 1U);
+}
+
+int32_t IRQ_ClearPending (IRQn_ID_t irqn) {
+  if (!os_irq_valid(irqn)) {
+    return -1;
+  }
+  __atomic_and_fetch(&os_irq_pend, ~(1UL << irqn), __ATOMIC_SEQ_CST);
+  return 0;
+}
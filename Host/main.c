@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+
+#include "cmsis_rv2.h"
+
+/* Test case filter from the command line arguments */
+static char cmd_line[1024];
+
+const char *TS_GetFilter (void) {
+  return (cmd_line);
+}
+
+int main (int argc, char *argv[]) {
+  int i;
+
+  for (i = 1; i < argc; i++) {
+    if ((strlen(cmd_line) + strlen(argv[i]) + 2U) > sizeof(cmd_line)) {
+      break;
+    }
+    strcat(cmd_line, argv[i]);
+    strcat(cmd_line, " ");
+  }
+
+  /* CMSIS-RTOS2 validation entry */
+  cmsis_rv2();
+}
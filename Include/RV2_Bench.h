@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RV2_BENCH_H__
+#define RV2_BENCH_H__
+
+#include <stdint.h>
+#include "cmsis_rv2.h"
+
+/* Number of samples collected per measurement */
+#ifndef BENCH_SAMPLE_CNT
+#define BENCH_SAMPLE_CNT          256
+#endif
+
+/* Measurement interval of throughput benchmarks [ms] */
+#ifndef BENCH_INTERVAL
+#define BENCH_INTERVAL            100
+#endif
+
+/* Maximum number of threads per role in scaling benchmarks */
+#ifndef BENCH_THREAD_CNT
+#define BENCH_THREAD_CNT          4
+#endif
+
+/* Maximum message queue data size (message size * depth) in message queue benchmarks [bytes] */
+#ifndef BENCH_MSGQ_MEM_SIZE
+#define BENCH_MSGQ_MEM_SIZE       4096
+#endif
+
+/* Maximum number of memory pool blocks in memory pool benchmarks */
+#ifndef BENCH_MPOOL_BLOCK_CNT
+#define BENCH_MPOOL_BLOCK_CNT     64
+#endif
+
+/* Memory pool block size in memory pool benchmarks [bytes] */
+#ifndef BENCH_MPOOL_BLOCK_SIZE
+#define BENCH_MPOOL_BLOCK_SIZE    16
+#endif
+
+/* Maximum number of threads woken by one event flags broadcast */
+#ifndef BENCH_EVFLAGS_WAITER_CNT
+#define BENCH_EVFLAGS_WAITER_CNT  8
+#endif
+
+/* Maximum number of concurrent periodic timers in timer benchmarks */
+#ifndef BENCH_TIMER_CNT
+#define BENCH_TIMER_CNT           8
+#endif
+
+/* Duration of each step in timer and periodic thread benchmarks [ticks] */
+#ifndef BENCH_TIMER_TICKS
+#define BENCH_TIMER_TICKS         1000
+#endif
+
+/* Maximum number of ready and blocked load threads in scheduler benchmarks */
+#ifndef BENCH_SCHED_THREAD_CNT
+#define BENCH_SCHED_THREAD_CNT    16
+#endif
+
+/* Maximum number of threads and timers with distinct timeouts in timeout benchmarks */
+#ifndef BENCH_TIMEOUT_CNT
+#define BENCH_TIMEOUT_CNT         16
+#endif
+
+/* Benchmark timestamp [timestamp cycles] */
+#define BENCH_TIME()              TS_GetTimestamp()
+
+/* Benchmark sample collection (thread context only) */
+extern void     Bench_Start  (void);
+extern void     Bench_Sample (uint32_t cycles);
+extern uint32_t Bench_Count  (void);
+
+/* Pseudo random numbers for access patterns (32-bit LFSR) */
+extern void     Bench_RandomSeed (uint32_t seed);
+extern uint32_t Bench_Random     (void);
+
+/* Benchmark result reporting (name is a printf format string, returns average) */
+extern uint32_t Bench_Report (const char *fmt, ...);
+extern void     Bench_Value  (uint32_t value, const char *unit, const char *fmt, ...);
+
+#endif /* RV2_BENCH_H__ */
@@ -27,6 +27,35 @@
 
 #include "tf_main.h"
 
+/* Test module file identifiers (assertion locations, see TF_FILE_ID) */
+enum {
+  RV2_FILE_KERNEL,
+  RV2_FILE_THREAD,
+  RV2_FILE_THREADFLAGS,
+  RV2_FILE_GENWAIT,
+  RV2_FILE_TIMER,
+  RV2_FILE_EVENTFLAGS,
+  RV2_FILE_MUTEX,
+  RV2_FILE_SEMAPHORE,
+  RV2_FILE_MEMORYPOOL,
+  RV2_FILE_MESSAGEQUEUE,
+  RV2_FILE_BENCH_THREAD,
+  RV2_FILE_BENCH_ISR,
+  RV2_FILE_BENCH_MUTEX,
+  RV2_FILE_BENCH_SEMAPHORE,
+  RV2_FILE_BENCH_MESSAGEQUEUE,
+  RV2_FILE_BENCH_MEMORYPOOL,
+  RV2_FILE_BENCH_EVENTFLAGS,
+  RV2_FILE_BENCH_TIMER,
+  RV2_FILE_BENCH_GENWAIT,
+  RV2_FILE_BENCH_OBJECT,
+  RV2_FILE_BENCH_KERNEL,
+  RV2_FILE_BENCH_SCHEDULER,
+  RV2_FILE_BENCH_TIMEOUT,
+  RV2_FILE_BENCH_ROUNDROBIN,
+  RV2_FILE_NUM
+};
+
 /* Interrupt handling */
 #define IRQ_A          0
 #define IRQ_B          1
@@ -44,6 +73,13 @@ extern void (*TST_IRQHandler_B)(void);
 extern int  cmsis_rv2 (void);
 extern void TS_Init   (void);
 extern void TS_Uninit (void);
+extern uint32_t TS_GetTimestamp     (void);
+extern uint32_t TS_GetTimestampFreq (void);
+extern const char *TS_GetFilter     (void);
+extern uint32_t TS_GetHeapSize      (void);
+extern uint32_t TS_GetHeapUsage     (void);
+extern uint32_t TS_GetHeapPeak      (void);
+extern uint32_t TS_StackPaint       (void);
 
 /* Test cases */
 extern void TC_osKernelInitialize_1       (void);
@@ -219,4 +255,37 @@ extern void TC_MsgQBasic                  (void);
 extern void TC_MsgQWait                   (void);
 extern void TC_MsgQCheckTimeout           (void);
 
+extern void TC_BenchThreadYield           (void);
+extern void TC_BenchThreadPreempt         (void);
+extern void TC_BenchThreadPingPong        (void);
+extern void TC_BenchIsrThreadFlags        (void);
+extern void TC_BenchIsrEventFlags         (void);
+extern void TC_BenchIsrSemaphore          (void);
+extern void TC_BenchIsrMessageQueue       (void);
+extern void TC_BenchIsrMemoryPool         (void);
+extern void TC_BenchMutexUncontended      (void);
+extern void TC_BenchMutexRecursive        (void);
+extern void TC_BenchMutexHandoff          (void);
+extern void TC_BenchMutexInheritChain     (void);
+extern void TC_BenchSemaphoreThroughput   (void);
+extern void TC_BenchMsgQLatency           (void);
+extern void TC_BenchMsgQThread            (void);
+extern void TC_BenchMsgQIsrToThread       (void);
+extern void TC_BenchMsgQThreadToIsr       (void);
+extern void TC_BenchMemPoolThread         (void);
+extern void TC_BenchMemPoolIsr            (void);
+extern void TC_BenchEvFlagsBroadcastAny   (void);
+extern void TC_BenchEvFlagsBroadcastAll   (void);
+extern void TC_BenchTimerPeriodic         (void);
+extern void TC_BenchDelayUntil            (void);
+extern void TC_BenchDelayUntilLoad        (void);
+extern void TC_BenchThreadLifecycle       (void);
+extern void TC_BenchObjectNewDelete       (void);
+extern void TC_BenchKernelThread          (void);
+extern void TC_BenchKernelIsr             (void);
+extern void TC_BenchSchedScaling          (void);
+extern void TC_BenchTimeoutThread         (void);
+extern void TC_BenchTimeoutTimer          (void);
+extern void TC_BenchRoundRobin            (void);
+
 #endif /* CMSIS_RV2_H__ */
@@ -21,7 +21,13 @@
 
 #include <stdint.h>
 
+/* Packed assertion location: file identifier [31:16], line number [15:0] */
+#define TF_LOC(id, ln)      ((((uint32_t)(id)) << 16) | (((uint32_t)(ln)) & 0xFFFFU))
+#define TF_LOC_FILE(loc)    ((uint32_t)(loc) >> 16)
+#define TF_LOC_LINE(loc)    ((uint32_t)(loc) & 0xFFFFU)
+
 /* Assertions */
 extern uint32_t __assert_true (const char *fn, uint32_t ln, uint32_t cond);
+extern uint32_t __assert_loc  (uint32_t loc, uint32_t cond);
 
 #endif /* TF_ASSERT_H__ */
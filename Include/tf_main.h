@@ -24,18 +24,47 @@
 #include "tf_assert.h"
 #include "tf_report.h"
 
+/*-----------------------------------------------------------------------------
+ * Test Framework Configuration
+ *----------------------------------------------------------------------------*/
+
+/*
+  Test case repeat count
+  Execute each selected test case the given number of times
+  (overridden by filter option --repeat N)
+*/
+#ifndef TF_REPEAT
+#define TF_REPEAT                   1
+#endif
+
+/*
+  Test case repeat time in milliseconds
+  Execute each selected test case repeatedly for the given time, 0 to use the
+  repeat count instead (overridden by filter option --repeat-time MS)
+*/
+#ifndef TF_REPEAT_TIME
+#define TF_REPEAT_TIME              0
+#endif
+
 /*-----------------------------------------------------------------------------
  * Test framework global definitions
  *----------------------------------------------------------------------------*/
 
 /* Test case definition macro                                                 */
-#define TCD(x, y) {x, #x, y}
+#define TCD(x, y) {x, #x, y, 0U}
+
+/* Test case definition macro with test case flags (TCF_*)                    */
+#define TCDF(x, y, f) {x, #x, y, f}
+
+/* Test case flags                                                            */
+#define TCF_NO_TIMEOUT  (1U << 0)     /* Run without test case time budget    */
 
 /* Test case description structure                                            */
 typedef struct __TestCase {
   void (*TestFunc)(void);             /* Test function                        */
   const char *TFName;                 /* Test function name string            */
   int32_t en;                         /* Test function enabled                */
+  uint32_t flags;                     /* Test case flags (TCF_*)              */
 } TEST_CASE;
 
 /* Test suite description structure                                           */
@@ -50,6 +79,14 @@ typedef struct __TestSuite {
   uint32_t TCBaseNum;                 /* Base number for test case numbering  */
   const TEST_CASE *TC;                /* Array of test cases                  */
   uint32_t NumOfTC;                   /* Number of test cases (sz of TC array)*/
+  uint32_t (*Timestamp)(void);        /* Timestamp counter (NULL: no timing)  */
+  uint32_t (*TimestampFreq)(void);    /* Timestamp counter frequency [Hz]     */
+  const char *(*Filter)(void);        /* Test case filter (NULL: run all)     */
+  uint32_t (*Execute)(const TEST_CASE *tc); /* Test case executor, returns 1
+                                         on timeout (NULL: call test function)*/
+  const char * const *Files;          /* Test module file names indexed by
+                                         TF_FILE_ID (NULL: none)              */
+  uint32_t NumOfFiles;                /* Number of test module file names     */
 
 } TEST_SUITE;
 
@@ -66,7 +103,15 @@ extern TEST_REPORT  TestReport;
 
 \param[in]  cond          condition to evaluate
 \return     Test result (true if test passed, false if test failed)
+
+  Modules that define TF_FILE_ID before including this header pass a packed
+  file identifier and line number instead of the __FILE__ string. The file
+  name is resolved through the test suite Files table when reporting.
 */
+#ifdef TF_FILE_ID
+#define ASSERT_TRUE(cond)             __assert_loc (TF_LOC(TF_FILE_ID, __LINE__), cond)
+#else
 #define ASSERT_TRUE(cond)             __assert_true (__FILE__, __LINE__, cond)
+#endif
 
 #endif /* TF_MAIN_H__ */
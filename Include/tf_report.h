@@ -33,6 +33,14 @@
 #define PRINT_XML_REPORT            0
 #endif
 
+/*
+  Print Binary Report <0=> Disabled <1=> Enabled
+  Output compact binary report records instead of plain text or XML
+*/
+#ifndef PRINT_BINARY_REPORT
+#define PRINT_BINARY_REPORT         0
+#endif
+
 /*
   Buffer size for assertions results
   Set the buffer size for assertions results buffer
@@ -41,6 +49,26 @@
 #define BUFFER_ASSERTIONS           16
 #endif
 
+/*
+  Deferred Output <0=> Disabled <1=> Test case boundaries <2=> Logger thread
+  Serialize report records into a ring buffer and write them to the output
+  at test case boundaries or from a low priority logger thread
+  When the ring buffer is full the producer writes the published records or
+  waits for the logger thread (records are dropped only where waiting is not
+  possible, e.g. in interrupt context or while the kernel is locked)
+*/
+#ifndef TF_OUTPUT_DEFERRED
+#define TF_OUTPUT_DEFERRED          0
+#endif
+
+/*
+  Deferred output ring buffer size (power of 2)
+  Set the ring buffer size in bytes used for deferred output
+*/
+#ifndef TF_OUTPUT_RING_SIZE
+#define TF_OUTPUT_RING_SIZE         4096
+#endif
+
 /*-----------------------------------------------------------------------------
  * Test report global definitions
  *----------------------------------------------------------------------------*/
@@ -67,6 +95,36 @@ typedef struct {
   uint32_t warnings;                /* Assertions warnings */
 } AS_STAT;
 
+/* Memory usage statistics */
+typedef struct {
+  uint32_t stack;                   /* Test case thread peak stack usage [bytes]  */
+  uint32_t tstack;                  /* Helper threads stack usage at end [bytes]  */
+  uint32_t heap;                    /* Kernel dynamic memory peak [bytes]         */
+  uint32_t heap_size;               /* Kernel dynamic memory size (0: unknown)    */
+} MEM_STAT;
+
+/* Test case repeat statistics */
+typedef struct {
+  uint32_t runs;                    /* Executed iterations                        */
+  uint32_t failed;                  /* Failed iterations (failed assertions)      */
+  uint32_t min;                     /* Minimum iteration time [timestamp cycles]  */
+  uint32_t max;                     /* Maximum iteration time [timestamp cycles]  */
+  uint32_t mean;                    /* Mean iteration time [timestamp cycles]     */
+  uint32_t dev;                     /* Iteration time std. deviation [cycles]     */
+} RUN_STAT;
+
+/* Benchmark measurement statistics */
+typedef struct {
+  const char *name;                 /* Measurement name                           */
+  uint32_t cnt;                     /* Number of samples                          */
+  uint32_t min;                     /* Minimum [timestamp cycles]                 */
+  uint32_t avg;                     /* Average [timestamp cycles]                 */
+  uint32_t max;                     /* Maximum [timestamp cycles]                 */
+  uint32_t p50;                     /* 50th percentile (median) [timestamp cycles]*/
+  uint32_t p90;                     /* 90th percentile [timestamp cycles]         */
+  uint32_t p99;                     /* 99th percentile [timestamp cycles]         */
+} BENCH_STAT;
+
 /* Test global statistics */
 typedef struct {
   uint32_t  tests;                  /* Total test cases count         */
@@ -75,15 +133,28 @@ typedef struct {
   uint32_t  failed;                 /* Total test cases failed        */
   uint32_t  warnings;               /* Total test cases warnings      */
   AS_STAT   assertions;             /* Total assertions statistics    */
+  uint64_t  cycles;                 /* Total test cases execution time [timestamp cycles] */
+  uint32_t  dropped;                /* Report records dropped (deferred output ring full, unable to wait) */
+  MEM_STAT  memory;                 /* Peak memory usage of all test cases        */
   AS_INFO   info[BUFFER_ASSERTIONS];/* Assertion failure/warning info */
 } TEST_REPORT;
 
 /* Test report interface */
 int32_t TReport_Init     (void);
+int32_t TReport_SetTimestamp (uint32_t (*timestamp)(void), uint32_t freq);
+int32_t TReport_SetFiles (const char * const *files, uint32_t num);
 int32_t TReport_Open     (const char *title, const char *date, const char *time, const char *fn);
 int32_t TReport_Close    (void);
 int32_t TReport_TestOpen (uint32_t num, const char *fn);
 int32_t TReport_TestAdd  (const char *fn, uint32_t ln, char *desc, TC_RES res);
+int32_t TReport_TestAddLoc (uint32_t loc, TC_RES res);
+int32_t TReport_TestTimeout (void);
+int32_t TReport_TestMemory  (const MEM_STAT *mem);
+int32_t TReport_TestIteration (void);
+int32_t TReport_TestBench   (const BENCH_STAT *stat);
+int32_t TReport_TestValue   (const char *name, uint32_t value, const char *unit);
 int32_t TReport_TestClose(void);
+uint32_t TReport_Drain   (void);
+uint32_t TReport_Pending (void);
 
 #endif /* TF_REPORT_H__ */
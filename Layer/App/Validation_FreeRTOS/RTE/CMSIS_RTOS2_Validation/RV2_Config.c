@@ -19,6 +19,8 @@
 #include <stdlib.h>
 #include "cmsis_rv2.h"
 #include "RV2_Config_Device.h"
+#include "FreeRTOS.h"
+#include "task.h"
 
 #if defined(__CORTEX_A)
 #include "irq_ctrl.h"
@@ -94,6 +96,54 @@ void TS_Uninit (void) {
   exit(0);
 }
 
+/*
+  Kernel dynamic memory size (FreeRTOS heap)
+*/
+uint32_t TS_GetHeapSize (void) {
+  return (configTOTAL_HEAP_SIZE);
+}
+
+/*
+  Kernel dynamic memory usage (FreeRTOS Heap_4)
+*/
+uint32_t TS_GetHeapUsage (void) {
+  return (configTOTAL_HEAP_SIZE - xPortGetFreeHeapSize());
+}
+
+#if (tskKERNEL_VERSION_MAJOR > 11) || ((tskKERNEL_VERSION_MAJOR == 11) && (tskKERNEL_VERSION_MINOR >= 1))
+/*
+  Kernel dynamic memory peak usage since the previous call (FreeRTOS Heap_4)
+*/
+uint32_t TS_GetHeapPeak (void) {
+  uint32_t peak = configTOTAL_HEAP_SIZE - xPortGetMinimumEverFreeHeapSize();
+
+  xPortResetHeapMinimumEverFreeHeapSize();
+  return (peak);
+}
+#endif
+
+#if (configUSE_TRACE_FACILITY == 1)
+/*
+  Fill the unused stack of the running task with the FreeRTOS stack fill byte
+*/
+uint32_t TS_StackPaint (void) {
+  TaskStatus_t status;
+  uint8_t *stack, *sp;
+
+  vTaskGetInfo(NULL, &status, pdFALSE, eRunning);
+#if defined(__CORTEX_M)
+  sp = (uint8_t *)__get_PSP();
+#else
+  sp = (uint8_t *)__get_SP();
+#endif
+  /* tskSTACK_FILL_BYTE */
+  for (stack = (uint8_t *)status.pxStackBase; stack < sp; stack++) {
+    *stack = 0xA5U;
+  }
+  return (1U);
+}
+#endif
+
 /*
   Enable interrupt trigger in the IRQ controller.
 */
@@ -19,6 +19,8 @@
 #include <stdlib.h>
 #include "cmsis_rv2.h"
 #include "RV2_Config_Device.h"
+#include "RTX_Config.h"
+#include "rtx_os.h"
 
 #if defined(__CORTEX_A)
 #include "irq_ctrl.h"
@@ -94,6 +96,52 @@ void TS_Uninit (void) {
   exit(0);
 }
 
+/*
+  Kernel dynamic memory size (RTX5 global memory pool)
+*/
+uint32_t TS_GetHeapSize (void) {
+  return (OS_DYNAMIC_MEM_SIZE);
+}
+
+/*
+  Kernel dynamic memory usage (memory pool header as defined in rtx_memory.c)
+  RTX5 does not record the peak usage: the default TS_GetHeapPeak returns the
+  usage at the end of the test case
+*/
+uint32_t TS_GetHeapUsage (void) {
+  const struct {
+    uint32_t size;
+    uint32_t used;
+  } *mem = osRtxInfo.mem.common;
+
+  if (mem == NULL) {
+    return (0U);
+  }
+  return (mem->used);
+}
+
+/*
+  Fill the unused stack of the running thread with the RTX5 stack watermark
+*/
+uint32_t TS_StackPaint (void) {
+  const osRtxThread_t *thread = (const osRtxThread_t *)osThreadGetId();
+  uint32_t *stack, *sp;
+
+  if ((thread == NULL) || ((osRtxConfig.flags & osRtxConfigStackWatermark) == 0U)) {
+    return (0U);
+  }
+#if defined(__CORTEX_M)
+  sp = (uint32_t *)__get_PSP();
+#else
+  sp = (uint32_t *)__get_SP();
+#endif
+  /* First word holds the stack overflow magic word */
+  for (stack = &((uint32_t *)thread->stack_mem)[1]; stack < sp; stack++) {
+    *stack = osRtxStackFillPattern;
+  }
+  return (1U);
+}
+
 /*
   Enable interrupt trigger in the IRQ controller.
 */
@@ -462,6 +462,121 @@
 #define TC_MSGQWAIT_EN                    1
 #define TC_MSGQCHECKTIMEOUT_EN            1
 //   </e>
+
+//   <e0>Benchmarks
+//   <i>Include benchmark test cases in the test suite
+//   <i>Benchmarks report latency statistics in timestamp cycles and nanoseconds
+//     <o01>Samples per measurement <16-4096>
+//     <i>Number of samples used for percentile calculation.
+//     <i>Default: 256
+//     <o02>Measurement interval [ms] <1-10000>
+//     <i>Duration of each throughput measurement.
+//     <i>Default: 100
+//     <o03>Maximum threads per role <1-16>
+//     <i>Maximum number of producer or consumer threads in scaling benchmarks.
+//     <i>Default: 4
+//     <o04>Maximum message queue data size [bytes] <64-1048576>
+//     <i>Message size and depth combinations exceeding the data size are skipped.
+//     <i>Default: 4096
+//     <o05>Maximum memory pool blocks <16-65536>
+//     <i>Largest memory pool in memory pool benchmarks; pools grow by a factor of 4 from 16 blocks.
+//     <i>Default: 64
+//     <o06>Memory pool block size [bytes] <4-1024>
+//     <i>Block size of memory pools in memory pool benchmarks.
+//     <i>Default: 16
+//     <o07>Maximum event flags waiter threads <1-64>
+//     <i>Largest number of threads woken by one osEventFlagsSet in broadcast benchmarks.
+//     <i>Default: 8
+//     <o08>Maximum concurrent periodic timers <1-64>
+//     <i>Largest number of periodic timers running concurrently in timer benchmarks.
+//     <i>Default: 8
+//     <o09>Timer measurement duration [ticks] <10-100000>
+//     <i>Duration of each timer count step and of periodic thread measurements;
+//     <i>all steps of a test case must complete within the test case timeout.
+//     <i>Default: 1000
+//     <o10>Maximum scheduler load threads <1-1024>
+//     <i>Largest number of ready and blocked threads in scheduler scalability benchmarks.
+//     <i>Default: 16
+//     <o11>Maximum timed waits <1-1024>
+//     <i>Largest number of threads and timers with distinct timeouts in timeout list benchmarks.
+//     <i>Default: 16
+//     <q12>TC_BenchThreadYield
+//     <q13>TC_BenchThreadPreempt
+//     <q14>TC_BenchThreadPingPong
+//     <q15>TC_BenchIsrThreadFlags
+//     <q16>TC_BenchIsrEventFlags
+//     <q17>TC_BenchIsrSemaphore
+//     <q18>TC_BenchIsrMessageQueue
+//     <q19>TC_BenchIsrMemoryPool
+//     <q20>TC_BenchMutexUncontended
+//     <q21>TC_BenchMutexRecursive
+//     <q22>TC_BenchMutexHandoff
+//     <q23>TC_BenchMutexInheritChain
+//     <q24>TC_BenchSemaphoreThroughput
+//     <q25>TC_BenchMsgQLatency
+//     <q26>TC_BenchMsgQThread
+//     <q27>TC_BenchMsgQIsrToThread
+//     <q28>TC_BenchMsgQThreadToIsr
+//     <q29>TC_BenchMemPoolThread
+//     <q30>TC_BenchMemPoolIsr
+//     <q31>TC_BenchEvFlagsBroadcastAny
+//     <q32>TC_BenchEvFlagsBroadcastAll
+//     <q33>TC_BenchTimerPeriodic
+//     <q34>TC_BenchDelayUntil
+//     <q35>TC_BenchDelayUntilLoad
+//     <q36>TC_BenchThreadLifecycle
+//     <q37>TC_BenchObjectNewDelete
+//     <q38>TC_BenchKernelThread
+//     <q39>TC_BenchKernelIsr
+//     <q40>TC_BenchSchedScaling
+//     <q41>TC_BenchTimeoutThread
+//     <q42>TC_BenchTimeoutTimer
+//     <q43>TC_BenchRoundRobin
+#define TC_BENCH_EN                       0
+#define BENCH_SAMPLE_CNT                  256
+#define BENCH_INTERVAL                    100
+#define BENCH_THREAD_CNT                  4
+#define BENCH_MSGQ_MEM_SIZE               4096
+#define BENCH_MPOOL_BLOCK_CNT             64
+#define BENCH_MPOOL_BLOCK_SIZE            16
+#define BENCH_EVFLAGS_WAITER_CNT          8
+#define BENCH_TIMER_CNT                   8
+#define BENCH_TIMER_TICKS                 1000
+#define BENCH_SCHED_THREAD_CNT            16
+#define BENCH_TIMEOUT_CNT                 16
+#define TC_BENCHTHREADYIELD_EN            1
+#define TC_BENCHTHREADPREEMPT_EN          1
+#define TC_BENCHTHREADPINGPONG_EN         1
+#define TC_BENCHISRTHREADFLAGS_EN         1
+#define TC_BENCHISREVENTFLAGS_EN          1
+#define TC_BENCHISRSEMAPHORE_EN           1
+#define TC_BENCHISRMESSAGEQUEUE_EN        1
+#define TC_BENCHISRMEMORYPOOL_EN          1
+#define TC_BENCHMUTEXUNCONTENDED_EN       1
+#define TC_BENCHMUTEXRECURSIVE_EN         1
+#define TC_BENCHMUTEXHANDOFF_EN           1
+#define TC_BENCHMUTEXINHERITCHAIN_EN      1
+#define TC_BENCHSEMAPHORETHROUGHPUT_EN    1
+#define TC_BENCHMSGQLATENCY_EN            1
+#define TC_BENCHMSGQTHREAD_EN             1
+#define TC_BENCHMSGQISRTOTHREAD_EN        1
+#define TC_BENCHMSGQTHREADTOISR_EN        1
+#define TC_BENCHMEMPOOLTHREAD_EN          1
+#define TC_BENCHMEMPOOLISR_EN             1
+#define TC_BENCHEVFLAGSBROADCASTANY_EN    1
+#define TC_BENCHEVFLAGSBROADCASTALL_EN    1
+#define TC_BENCHTIMERPERIODIC_EN          1
+#define TC_BENCHDELAYUNTIL_EN             1
+#define TC_BENCHDELAYUNTILLOAD_EN         1
+#define TC_BENCHTHREADLIFECYCLE_EN        1
+#define TC_BENCHOBJECTNEWDELETE_EN        1
+#define TC_BENCHKERNELTHREAD_EN           1
+#define TC_BENCHKERNELISR_EN              1
+#define TC_BENCHSCHEDSCALING_EN           1
+#define TC_BENCHTIMEOUTTHREAD_EN          1
+#define TC_BENCHTIMEOUTTIMER_EN           1
+#define TC_BENCHROUNDROBIN_EN             1
+//   </e>
 // </h>
 // </h>
 
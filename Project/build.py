@@ -2,12 +2,17 @@
 # -*- coding: utf-8 -*-
 
 import logging
+import os
+import re
+import subprocess
 
+from concurrent.futures import ThreadPoolExecutor
 from datetime import datetime
 from enum import Enum
 from glob import glob, iglob
 from pathlib import Path
 
+from lxml import etree
 from lxml.etree import XMLSyntaxError
 from zipfile import ZipFile
 
@@ -73,6 +78,10 @@ MODEL_EXECUTABLE = {
     DeviceAxis.CM85:    ("FVP_MPS2_Cortex-M85", []),
 }
 
+# Number of model instances running the test cases in parallel shards
+SHARDS = int(os.environ.get("RV2_SHARDS", "1"))
+
+
 def config_suffix(config, timestamp=True):
     suffix = f"{config.rtos}-{config.device[1]}-{config.compiler}"
     if timestamp:
@@ -126,8 +135,13 @@ def extract(config):
 
 @matrix_action
 def run(config, results):
-    """Run the selected configurations."""
+    """Run the selected configurations (split into RV2_SHARDS parallel model instances)."""
     logging.info("Running Validation on Arm virtual Hardware Targets ...")
+
+    if SHARDS > 1:
+        run_shards(config, SHARDS)
+        return
+
     yield model_exec(config)
 
     try:
@@ -139,6 +153,61 @@ def run(config, results):
             logging.exception(ex)
 
 
+def semihosting_cmd_line(config):
+    """Return the model parameter holding the semihosting command line."""
+    with open(model_config(config)) as f:
+        for line in f:
+            match = re.match(r'\s*(\S+\.semihosting-cmd_line)\s*=', line)
+            if match:
+                return match.group(1)
+    raise RuntimeError(f"No semihosting-cmd_line parameter in {model_config(config)}")
+
+
+def run_shard(config, shard, shards):
+    """Run one shard of the test cases and return its JUnit testsuite (None without a valid report)."""
+    cmdline = [str(arg) for arg in model_cmdline(config)]
+    cmdline += ["-C", f"{semihosting_cmd_line(config)}=--shard={shard}/{shards}"]
+    result = subprocess.run(cmdline, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, check=False)
+
+    logging.info("Output of shard %d/%d:\n%s", shard, shards, result.stdout.decode(errors="replace"))
+    if result.returncode != 0:
+        logging.error("Shard %d/%d: model exited with status %d!", shard, shards, result.returncode)
+
+    report = re.search(rb'<\?xml version="1.0"\?>.*?</report>', result.stdout, re.DOTALL)
+    try:
+        if report is not None:
+            junit = etree.XSLT(etree.parse("validation.xsl"))(etree.fromstring(report.group(0)))
+            return junit.getroot().find("testsuite")
+    except XMLSyntaxError:
+        pass
+    logging.error("Shard %d/%d: No valid test report found in model output!", shard, shards)
+    return None
+
+
+def run_shards(config, shards):
+    """Run the test cases in parallel model instances and merge the JUnit reports."""
+    with ThreadPoolExecutor(max_workers=shards) as executor:
+        suites = list(executor.map(lambda i: run_shard(config, i, shards), range(1, shards + 1)))
+
+    suites = [suite for suite in suites if suite is not None]
+    if not suites:
+        logging.error("No valid test report found in model output!")
+        return
+
+    merged = etree.Element("testsuite", name=f"{config.rtos}.{config.device}.{config.compiler}."
+                                             f"{suites[0].get('name')}")
+    for attr in ("tests", "failures", "errors", "skipped"):
+        merged.set(attr, str(sum(int(suite.get(attr, "0")) for suite in suites)))
+    merged.set("time", str(sum(float(suite.get("time", "0")) for suite in suites)))
+    for suite in suites:
+        merged.extend(suite.findall("testcase"))
+
+    testsuites = etree.Element("testsuites")
+    testsuites.append(merged)
+    etree.ElementTree(testsuites).write(f"Validation-{config_suffix(config)}.junit",
+                                        xml_declaration=True, encoding="UTF-8", pretty_print=True)
+
+
 @matrix_command()
 def cbuild_clean(project):
     return ["cbuild", "-c", project]
@@ -165,6 +234,10 @@ def cbuild(config):
                                                                     f"{result.command.config.compiler}."
                                                                     f"{title}"))
 def model_exec(config):
+    return model_cmdline(config)
+
+
+def model_cmdline(config):
     cmdline = [MODEL_EXECUTABLE[config.device][0], "-q", "--simlimit", 100, "-f", model_config(config)]
     cmdline += MODEL_EXECUTABLE[config.device][1]
     cmdline += ["-a", f"{project_name(config)}/{output_dir(config)}/Validation.{config.compiler.image_ext}"]
@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Decode a binary test report (PRINT_BINARY_REPORT 1) and emit the same
+# JUnit XML as validation.xsl produces from the XML report, or a plain
+# text report.
+
+import argparse
+import re
+import struct
+import sys
+import xml.etree.ElementTree as ET
+
+from pathlib import Path
+
+SYNC = b'\xa5\x5a'
+VERSION = 1
+
+REPORT_OPEN = 0x01
+TC_DETAIL = 0x02
+TC_CLOSE = 0x03
+REPORT_CLOSE = 0x04
+TC_MEMORY = 0x05
+REPORT_MEMORY = 0x06
+TC_REPEAT = 0x07
+FILE_NAME = 0x08
+TC_DETAIL_LOC = 0x09
+TC_BENCH = 0x0A
+TC_VALUE = 0x0B
+
+RESULTS = ('PASSED', 'WARNING', 'FAILED', 'NOT EXECUTED', 'TIMEOUT')
+
+DEFAULT_SOURCE = Path(__file__).resolve().parent.parent / 'Source'
+
+
+def result(code):
+    return RESULTS[code] if code < len(RESULTS) else 'FAILED'
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE as computed by tf_report.c"""
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def fnv1a(text):
+    """FNV-1a hash used to identify test function and file names"""
+    h = 2166136261
+    for b in text.encode():
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def load_names(paths):
+    """Build hash to name maps for test functions and source files"""
+    funcs, files = {}, {}
+    for path in paths:
+        path = Path(path)
+        sources = sorted(path.rglob('*.c')) if path.is_dir() else [path]
+        for src in sources:
+            files[fnv1a(src.name)] = src.name
+            text = src.read_text(errors='ignore')
+            for name in re.findall(r'\b(TC_\w+)\s*\(', text):
+                funcs[fnv1a(name)] = name
+    return funcs, files
+
+
+def records(data):
+    """Yield (type, payload) of all valid records, skip garbage and corrupted frames"""
+    errors = 0
+    pos = data.find(SYNC)
+    while 0 <= pos <= len(data) - 6:
+        rtype, rlen = data[pos + 2], data[pos + 3]
+        end = pos + 4 + rlen
+        if end + 2 <= len(data):
+            payload = data[pos + 4:end]
+            crc, = struct.unpack_from('<H', data, end)
+            if crc == crc16(data[pos + 2:end]):
+                yield rtype, payload
+                pos = data.find(SYNC, end + 2)
+                continue
+        errors += 1
+        pos = data.find(SYNC, pos + 1)
+    if errors:
+        print(f'warning: {errors} corrupted record(s) skipped', file=sys.stderr)
+
+
+class Report:
+    def __init__(self):
+        self.title = 'CMSIS-RTOS2 Test Suite'
+        self.freq = 0
+        self.tests = []
+        self.details = {}
+        self.summary = None
+        self.memory = {}
+        self.repeat = {}
+        self.bench = {}
+        self.files = {}
+        self.peak = None
+
+    def decode(self, data, funcs, files):
+        for rtype, p in records(data):
+            if rtype == REPORT_OPEN:
+                version, self.freq = struct.unpack_from('<BI', p)
+                if version != VERSION:
+                    raise ValueError(f'unsupported binary report version {version}')
+                self.title = p[5:].decode(errors='replace')
+            elif rtype == TC_DETAIL:
+                num, res, _, fhash, line = struct.unpack_from('<HBBII', p)
+                module = files.get(fhash, f'0x{fhash:08X}')
+                self.details.setdefault(num, []).append((module, line, result(res)))
+            elif rtype == FILE_NAME:
+                fid, = struct.unpack_from('<H', p)
+                self.files[fid] = p[2:].decode(errors='replace')
+            elif rtype == TC_DETAIL_LOC:
+                num, res, _, fid, line = struct.unpack_from('<HBBHH', p)
+                module = self.files.get(fid, f'file {fid}')
+                self.details.setdefault(num, []).append((module, line, result(res)))
+            elif rtype == TC_CLOSE:
+                num, res, _, nhash, passed, failed, warnings, cycles = struct.unpack_from('<HBBIHHHI', p)
+                name = funcs.get(nhash, f'TC_{num}')
+                self.tests.append((num, name, result(res), cycles))
+            elif rtype == TC_MEMORY:
+                num, _, stack, tstack, heap = struct.unpack_from('<HHIII', p)
+                self.memory[num] = (stack, tstack, heap)
+            elif rtype == TC_REPEAT:
+                num, _, runs, failed, tmin, tmean, tmax, tdev = struct.unpack_from('<HHIIIIII', p)
+                self.repeat[num] = (runs, failed, tmin, tmean, tmax, tdev)
+            elif rtype == TC_BENCH:
+                num, _, *stat = struct.unpack_from('<HHIIIIIII', p)
+                name = p[32:].decode(errors='replace')
+                self.bench.setdefault(num, []).append((name, stat))
+            elif rtype == TC_VALUE:
+                num, _, value = struct.unpack_from('<HHI', p)
+                name, _, unit = p[8:].decode(errors='replace').partition('\0')
+                self.bench.setdefault(num, []).append((name, (value, unit)))
+            elif rtype == REPORT_MEMORY:
+                self.peak = struct.unpack_from('<IIII', p)
+            elif rtype == REPORT_CLOSE:
+                v = struct.unpack_from('<HHHHHHIII', p)
+                self.summary = {'tests': v[0], 'executed': v[1], 'passed': v[2], 'failed': v[3],
+                                'warnings': v[4], 'dropped': v[6], 'cycles': v[7] | (v[8] << 32)}
+        if self.summary is None:
+            # Report incomplete: derive summary from test case records
+            res = [t[2] for t in self.tests]
+            self.summary = {'tests': len(res), 'executed': len(res) - res.count('NOT EXECUTED'),
+                            'passed': res.count('PASSED'), 'failed': res.count('FAILED') + res.count('TIMEOUT'),
+                            'warnings': res.count('WARNING'), 'dropped': 0,
+                            'cycles': sum(t[3] for t in self.tests)}
+
+    def time(self, cycles):
+        if self.freq == 0:
+            return '0'
+        return f'{cycles // self.freq}.{(cycles % self.freq) * 1000000 // self.freq:06d}'
+
+    def ns(self, cycles):
+        return cycles * 1000000000 // self.freq if self.freq != 0 else 0
+
+    def junit(self):
+        s = self.summary
+        suites = ET.Element('testsuites')
+        suite = ET.SubElement(suites, 'testsuite', name=self.title, tests=str(s['tests']),
+                              time=self.time(s['cycles']), failures=str(s['failed']), errors='0',
+                              skipped=str(s['tests'] - s['executed']))
+        for num, name, res, cycles in self.tests:
+            tc = ET.SubElement(suite, 'testcase', name=name, time=self.time(cycles))
+            props = ET.Element('properties')
+            if num in self.memory:
+                stack, tstack, heap = self.memory[num]
+                ET.SubElement(props, 'property', name='stack', value=str(stack))
+                ET.SubElement(props, 'property', name='tstack', value=str(tstack))
+                if self.peak is not None and self.peak[3] != 0:
+                    ET.SubElement(props, 'property', name='heap', value=str(heap))
+            if num in self.repeat:
+                runs, failed, *times = self.repeat[num]
+                ET.SubElement(props, 'property', name='runs', value=str(runs))
+                ET.SubElement(props, 'property', name='rfail', value=str(failed))
+                if self.freq != 0:
+                    for key, cycles in zip(('tmin', 'tmean', 'tmax', 'tdev'), times):
+                        ET.SubElement(props, 'property', name=key, value=self.time(cycles))
+            for name, stat in self.bench.get(num, []):
+                if len(stat) == 2:
+                    ET.SubElement(props, 'property', name=name, value=f'{stat[0]} {stat[1]}')
+                    continue
+                ET.SubElement(props, 'property', name=f'{name}.cnt', value=str(stat[0]))
+                keys = ('min', 'avg', 'max', 'p50', 'p90', 'p99')
+                for key, cycles in zip(keys, stat[1:]):
+                    ET.SubElement(props, 'property', name=f'{name}.{key}', value=str(cycles))
+                if self.freq != 0:
+                    for key, cycles in zip(keys, stat[1:]):
+                        ET.SubElement(props, 'property', name=f'{name}.{key}_ns', value=str(self.ns(cycles)))
+            if len(props):
+                tc.append(props)
+            if res == 'NOT EXECUTED':
+                ET.SubElement(tc, 'skipped')
+            elif res != 'PASSED':
+                for module, line, _ in self.details.get(num, []):
+                    ET.SubElement(tc, 'failure').text = f'{module}:{line}'
+                if res == 'TIMEOUT':
+                    ET.SubElement(tc, 'failure').text = 'TIMEOUT'
+        ET.indent(suites)
+        return '<?xml version="1.0"?>\n' + ET.tostring(suites, encoding='unicode') + '\n'
+
+    def text(self):
+        s = self.summary
+        out = [f'{self.title}\n']
+        for num, name, res, _ in self.tests:
+            line = f'TEST {num:2d}: {name:32s} '
+            for module, ln, r in self.details.get(num, []):
+                line += f'\n  {module} ({ln}) [{r}]'
+            for name, stat in self.bench.get(num, []):
+                if len(stat) == 2:
+                    line += f'\n  {name}: {stat[0]} {stat[1]}'
+                    continue
+                cnt, *cycles = stat
+                line += (f'\n  {name}: {cnt} samples, min/avg/max {cycles[0]}/{cycles[1]}/{cycles[2]}, '
+                         f'p50/p90/p99 {cycles[3]}/{cycles[4]}/{cycles[5]} cycles')
+                if self.freq != 0:
+                    ns = [self.ns(c) for c in cycles]
+                    line += f'\n    min/avg/max {ns[0]}/{ns[1]}/{ns[2]}, p50/p90/p99 {ns[3]}/{ns[4]}/{ns[5]} ns'
+            if line.find('\n') != -1 and res in ('PASSED', 'NOT EXECUTED', 'TIMEOUT'):
+                line += '\n  '
+            out.append(line + (res if res in ('PASSED', 'NOT EXECUTED', 'TIMEOUT') else ''))
+            if num in self.repeat:
+                runs, failed, *times = self.repeat[num]
+                line = f'  Runs: {runs}, {failed} Failed'
+                if self.freq != 0:
+                    line += ', Time min/mean/max/dev: ' + '/'.join(self.time(t) for t in times) + ' s'
+                out.append(line)
+        out.append(f"\nTest Summary: {s['tests']} Tests, {s['executed']} Executed, {s['passed']} Passed, "
+                   f"{s['failed']} Failed, {s['warnings']} Warnings.")
+        if self.freq != 0:
+            out.append(f"Test Time: {self.time(s['cycles'])} s")
+        if self.peak is not None:
+            stack, tstack, heap, heap_size = self.peak
+            line = f'Test Memory: {stack} bytes stack, {tstack} bytes helper stack at test end'
+            out.append(line + (f', {heap} of {heap_size} bytes heap peak.' if heap_size != 0 else '.'))
+        if s['dropped'] != 0:
+            out.append(f"Test Output: {s['dropped']} records dropped.")
+        return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode CMSIS-RTOS2 Validation binary test report.')
+    parser.add_argument('input', nargs='?', help='binary report file (default: stdin)')
+    parser.add_argument('-o', '--output', help='output file (default: stdout)')
+    parser.add_argument('-f', '--format', choices=('junit', 'text'), default='junit', help='output format')
+    parser.add_argument('-s', '--source', action='append',
+                        help=f'source file or directory used to resolve names (default: {DEFAULT_SOURCE})')
+    args = parser.parse_args()
+
+    data = Path(args.input).read_bytes() if args.input else sys.stdin.buffer.read()
+    funcs, files = load_names(args.source or [DEFAULT_SOURCE])
+
+    report = Report()
+    report.decode(data, funcs, files)
+    if not report.tests:
+        print('error: no test records found', file=sys.stderr)
+        return 1
+
+    result = report.junit() if args.format == 'junit' else report.text()
+    if args.output:
+        Path(args.output).write_text(result)
+    else:
+        sys.stdout.write(result)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
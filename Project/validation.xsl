@@ -9,14 +9,46 @@
             <xsl:variable name="numberOfFailures" select="//report/test/summary/fail"/>
 			<xsl:variable name="numberOfSkips" select="$numberOfTests - $numberOfExecutes"/>
 			<xsl:variable name="numberOfErrors" select="0"/>
+            <xsl:variable name="totalTime">
+                <xsl:choose>
+                    <xsl:when test="//report/test/summary/time"><xsl:value-of select="//report/test/summary/time"/></xsl:when>
+                    <xsl:otherwise>0</xsl:otherwise>
+                </xsl:choose>
+            </xsl:variable>
             <testsuite name="{$buildName}"
-                       tests="{$numberOfTests}" time="0"
+                       tests="{$numberOfTests}" time="{$totalTime}"
                        failures="{$numberOfFailures}" errors="{$numberOfErrors}"
                        skipped="{$numberOfSkips}">
                 <xsl:for-each select="//report/test/test_cases/tc">
                     <xsl:variable name="testName" select="func"/>
                     <xsl:variable name="status" select="res"/>
-                    <testcase name="{$testName}">
+                    <xsl:variable name="testTime">
+                        <xsl:choose>
+                            <xsl:when test="time"><xsl:value-of select="time"/></xsl:when>
+                            <xsl:otherwise>0</xsl:otherwise>
+                        </xsl:choose>
+                    </xsl:variable>
+                    <testcase name="{$testName}" time="{$testTime}">
+                        <xsl:if test="stack or runs or dbgi/bench or dbgi/value">
+                            <properties>
+                                <xsl:for-each select="stack|tstack|heap|runs|rfail|tmin|tmean|tmax|tdev">
+                                    <property name="{local-name()}" value="{.}"/>
+                                </xsl:for-each>
+                                <xsl:for-each select="dbgi/bench">
+                                    <xsl:variable name="benchName" select="name"/>
+                                    <property name="{$benchName}.cnt" value="{cnt}"/>
+                                    <xsl:for-each select="cyc/*">
+                                        <property name="{$benchName}.{local-name()}" value="{.}"/>
+                                    </xsl:for-each>
+                                    <xsl:for-each select="ns/*">
+                                        <property name="{$benchName}.{local-name()}_ns" value="{.}"/>
+                                    </xsl:for-each>
+                                </xsl:for-each>
+                                <xsl:for-each select="dbgi/value">
+                                    <property name="{name}" value="{val} {unit}"/>
+                                </xsl:for-each>
+                            </properties>
+                        </xsl:if>
                         <xsl:choose>
                             <xsl:when test="res='PASSED'"/>
 							<xsl:when test="res='NOT EXECUTED'">
@@ -30,6 +62,9 @@
                                         <xsl:value-of select="$file"/>:<xsl:value-of select="$line"/>
                                     </failure>
                                 </xsl:for-each>
+                                <xsl:if test="res='TIMEOUT'">
+                                    <failure>TIMEOUT</failure>
+                                </xsl:if>
                             </xsl:otherwise>
                         </xsl:choose>
                     </testcase>
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "RV2_Bench.h"
+
+#if (TC_BENCH_EN)
+
+/* Collected samples (uniform random subset of BENCH_SAMPLE_CNT kept for percentiles) */
+static uint32_t Bench_Buf[BENCH_SAMPLE_CNT];
+static uint32_t Bench_Cnt;
+static uint32_t Bench_Min;
+static uint32_t Bench_Max;
+static uint64_t Bench_Sum;
+
+/* Measurement name */
+static char     Bench_Name[64];
+
+/* Random generator state */
+static uint32_t Bench_Lfsr = 0xAA55AA55U;
+
+/* Sample replacement generator state (independent of Bench_Random) */
+static uint32_t Bench_SampleLfsr = 0x5AA55AA5U;
+
+/*-----------------------------------------------------------------------------
+ *      Sort samples in ascending order (shell sort)
+ *----------------------------------------------------------------------------*/
+static void Bench_Sort (uint32_t *buf, uint32_t num) {
+  uint32_t gap, i, j, val;
+
+  for (gap = num / 2U; gap != 0U; gap /= 2U) {
+    for (i = gap; i < num; i++) {
+      val = buf[i];
+      for (j = i; (j >= gap) && (buf[j - gap] > val); j -= gap) {
+        buf[j] = buf[j - gap];
+      }
+      buf[j] = val;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ *      Start new measurement
+ *----------------------------------------------------------------------------*/
+void Bench_Start (void) {
+  Bench_Cnt = 0U;
+  Bench_Min = UINT32_MAX;
+  Bench_Max = 0U;
+  Bench_Sum = 0U;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Add sample to the measurement
+ *----------------------------------------------------------------------------*/
+void Bench_Sample (uint32_t cycles) {
+  uint32_t i;
+
+  if (Bench_Cnt < BENCH_SAMPLE_CNT) {
+    Bench_Buf[Bench_Cnt] = cycles;
+  } else {
+    /* Reservoir sampling: keep the sample with probability BENCH_SAMPLE_CNT / count */
+    Bench_SampleLfsr = (Bench_SampleLfsr >> 1) ^ (-(Bench_SampleLfsr & 1U) & 0xD0000001U);
+    i = Bench_SampleLfsr % (Bench_Cnt + 1U);
+    if (i < BENCH_SAMPLE_CNT) {
+      Bench_Buf[i] = cycles;
+    }
+  }
+  Bench_Cnt++;
+
+  if (cycles < Bench_Min) { Bench_Min = cycles; }
+  if (cycles > Bench_Max) { Bench_Max = cycles; }
+  Bench_Sum += cycles;
+}
+
+/*-----------------------------------------------------------------------------
+ *      Get number of samples of the measurement
+ *----------------------------------------------------------------------------*/
+uint32_t Bench_Count (void) {
+  return (Bench_Cnt);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Set random generator state
+ *----------------------------------------------------------------------------*/
+void Bench_RandomSeed (uint32_t seed) {
+  Bench_Lfsr = (seed != 0U) ? seed : 0xAA55AA55U;
+}
+
+/*-----------------------------------------------------------------------------
+ *      32-bit LFSR with maximal period (x^32 + x^31 + x^29 + x + 1)
+ *----------------------------------------------------------------------------*/
+uint32_t Bench_Random (void) {
+  Bench_Lfsr = (Bench_Lfsr >> 1) ^ (-(Bench_Lfsr & 1U) & 0xD0000001U);
+  return (Bench_Lfsr);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Report measurement statistics and start new measurement
+ *      (returns average of the reported measurement)
+ *----------------------------------------------------------------------------*/
+uint32_t Bench_Report (const char *fmt, ...) {
+  BENCH_STAT st;
+  va_list    args;
+  uint32_t   n;
+
+  st.avg = 0U;
+  if (Bench_Cnt != 0U) {
+    va_start (args, fmt);
+    vsnprintf (Bench_Name, sizeof(Bench_Name), fmt, args);
+    va_end (args);
+
+    n = (Bench_Cnt < BENCH_SAMPLE_CNT) ? Bench_Cnt : BENCH_SAMPLE_CNT;
+    Bench_Sort (Bench_Buf, n);
+
+    st.name = Bench_Name;
+    st.cnt  = Bench_Cnt;
+    st.min  = Bench_Min;
+    st.avg  = (uint32_t)(Bench_Sum / Bench_Cnt);
+    st.max  = Bench_Max;
+    st.p50  = Bench_Buf[(n * 50U) / 100U];
+    st.p90  = Bench_Buf[(n * 90U) / 100U];
+    st.p99  = Bench_Buf[(n * 99U) / 100U];
+    TReport_TestBench (&st);
+  }
+
+  Bench_Start();
+
+  return (st.avg);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Report measurement value
+ *----------------------------------------------------------------------------*/
+void Bench_Value (uint32_t value, const char *unit, const char *fmt, ...) {
+  va_list args;
+
+  va_start (args, fmt);
+  vsnprintf (Bench_Name, sizeof(Bench_Name), fmt, args);
+  va_end (args);
+
+  TReport_TestValue (Bench_Name, value, unit);
+}
+
+#endif /* TC_BENCH_EN */
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_EVENTFLAGS
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_FLAG_GO     0x0001U       /* Wait for the next broadcast    */
+
+/* Event flags set by the broadcast */
+#define BENCH_EVFLAGS_MSK ((uint32_t)((1ULL << MAX_EVENTFLAGS_CNT) - 1U))
+
+#if (TC_BENCH_EN)
+static osEventFlagsId_t  Bench_EfId;
+static uint32_t          Bench_Option;  /* osFlagsWaitAny or osFlagsWaitAll  */
+static uint32_t          Bench_Waiters; /* Number of waiting threads         */
+static volatile uint32_t Bench_Woken;   /* Waiters run since the broadcast   */
+static volatile uint32_t Bench_Errors;  /* Failed osEventFlagsWait calls     */
+static volatile uint32_t Bench_Stop;    /* Waiters exit on next GO           */
+static volatile uint32_t Bench_T0;      /* Timestamp before osEventFlagsSet  */
+static osThreadId_t      Bench_WaitId[BENCH_EVFLAGS_WAITER_CNT];
+static uint32_t          Bench_Mask  [BENCH_EVFLAGS_WAITER_CNT];
+
+void Th_BenchEvFlagsWaiter (void *arg);
+void Bench_EvFlagsBroadcast (uint32_t option, const char *name);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchEvFlagsBroadcastAny
+\details
+- Block 1 to BENCH_EVFLAGS_WAITER_CNT higher priority threads in osEventFlagsWait with osFlagsWaitAny,
+  each waiting for a different one of MAX_EVENTFLAGS_CNT flags
+- Set all flags with one osEventFlagsSet call while the kernel is locked
+- Report the cost of the osEventFlagsSet call and the time from the call until the last waiter runs
+*/
+void TC_BenchEvFlagsBroadcastAny (void) {
+#if (TC_BENCHEVFLAGSBROADCASTANY_EN)
+  Bench_EvFlagsBroadcast (osFlagsWaitAny, "wait any");
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchEvFlagsBroadcastAll
+\details
+- Block 1 to BENCH_EVFLAGS_WAITER_CNT higher priority threads in osEventFlagsWait with osFlagsWaitAll,
+  each waiting for a mask of 1 up to MAX_EVENTFLAGS_CNT flags
+- Set all flags with one osEventFlagsSet call while the kernel is locked
+- Report the cost of the osEventFlagsSet call and the time from the call until the last waiter runs
+*/
+void TC_BenchEvFlagsBroadcastAll (void) {
+#if (TC_BENCHEVFLAGSBROADCASTALL_EN)
+  Bench_EvFlagsBroadcast (osFlagsWaitAll, "wait all");
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * Waiter: wait for the broadcast, the last woken waiter takes the sample
+ *----------------------------------------------------------------------------*/
+void Th_BenchEvFlagsWaiter (void *arg) {
+  uint32_t mask = *(uint32_t *)arg;
+  uint32_t flags, t;
+
+  while (Bench_Stop == 0U) {
+    /* All waiters see the flags, they are cleared by the test case thread */
+    flags = osEventFlagsWait (Bench_EfId, mask, Bench_Option | osFlagsNoClear, osWaitForever);
+    t = BENCH_TIME();
+    if (((int32_t)flags < 0) || ((flags & mask) != mask)) {
+      Bench_Errors++;
+    }
+    Bench_Woken++;
+    if (Bench_Woken == Bench_Waiters) {
+      Bench_Sample (t - Bench_T0);
+    }
+    osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, osWaitForever);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Broadcast to 1 up to BENCH_EVFLAGS_WAITER_CNT waiters using the given wait option
+ *----------------------------------------------------------------------------*/
+void Bench_EvFlagsBroadcast (uint32_t option, const char *name) {
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityAboveNormal, 0U, 0U};
+  uint32_t n, i, k, cnt, t0, t1;
+  uint64_t sum;
+  int32_t  lock;
+
+  Bench_EfId = osEventFlagsNew (NULL);
+  ASSERT_TRUE (Bench_EfId != NULL);
+  if (Bench_EfId == NULL) {
+    return;
+  }
+  Bench_Option = option;
+
+  n = 1U;
+  for (;;) {
+    Bench_Waiters = n;
+    Bench_Woken   = 0U;
+    Bench_Errors  = 0U;
+    Bench_Stop    = 0U;
+
+    /* Higher priority waiters run and block on creation */
+    for (cnt = 0U; cnt < n; cnt++) {
+      k = cnt % MAX_EVENTFLAGS_CNT;
+      if (option == osFlagsWaitAll) {
+        Bench_Mask[cnt] = (uint32_t)((1ULL << (k + 1U)) - 1U);
+      } else {
+        Bench_Mask[cnt] = 1UL << k;
+      }
+      Bench_WaitId[cnt] = osThreadNew (Th_BenchEvFlagsWaiter, &Bench_Mask[cnt], &attr);
+      ASSERT_TRUE (Bench_WaitId[cnt] != NULL);
+      if (Bench_WaitId[cnt] == NULL) {
+        break;
+      }
+    }
+
+    Bench_Start();
+    sum = 0U;
+
+    for (i = 0U; (cnt == n) && (i < BENCH_SAMPLE_CNT); i++) {
+      Bench_Woken = 0U;
+
+      /* Waiters are woken when the kernel is unlocked */
+      lock = osKernelLock();
+      t0 = BENCH_TIME();
+      Bench_T0 = t0;
+      osEventFlagsSet (Bench_EfId, BENCH_EVFLAGS_MSK);
+      t1 = BENCH_TIME();
+      osKernelRestoreLock (lock);
+
+      sum += t1 - t0;
+      if (Bench_Woken != n) {
+        break;
+      }
+
+      /* Waiters block again when released */
+      osEventFlagsClear (Bench_EfId, BENCH_EVFLAGS_MSK);
+      if (i < (BENCH_SAMPLE_CNT - 1U)) {
+        for (k = 0U; k < n; k++) {
+          osThreadFlagsSet (Bench_WaitId[k], BENCH_FLAG_GO);
+        }
+      }
+    }
+    ASSERT_TRUE (i == BENCH_SAMPLE_CNT);
+    ASSERT_TRUE (Bench_Errors == 0U);
+
+    if (i != 0U) {
+      Bench_Value ((uint32_t)(sum / i), "cycles", "osEventFlagsSet %s, %d waiters", name, n);
+    }
+    Bench_Report ("set to last waiter %s, %d waiters", name, n);
+
+    /* Release waiters to exit */
+    Bench_Stop = 1U;
+    for (k = 0U; k < cnt; k++) {
+      osThreadFlagsSet (Bench_WaitId[k], BENCH_FLAG_GO);
+    }
+    if ((cnt != n) || (i != BENCH_SAMPLE_CNT)) {
+      /* Wake waiters still blocked on the event flags */
+      osEventFlagsSet (Bench_EfId, BENCH_EVFLAGS_MSK);
+      break;
+    }
+
+    /* Double the waiters, last step measures BENCH_EVFLAGS_WAITER_CNT waiters */
+    if (n >= BENCH_EVFLAGS_WAITER_CNT) {
+      break;
+    }
+    n = ((2U * n) < BENCH_EVFLAGS_WAITER_CNT) ? (2U * n) : BENCH_EVFLAGS_WAITER_CNT;
+  }
+
+  ASSERT_TRUE (osEventFlagsDelete (Bench_EfId) == osOK);
+}
+#endif
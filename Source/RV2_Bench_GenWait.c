@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_GENWAIT
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_PERIODIC_CNT  4U          /* Periodic threads               */
+#define BENCH_FLAG_BURST    0x0010U     /* Burst load thread completed    */
+#define BENCH_FLAG_SPIN     0x0020U     /* Spin load thread completed     */
+
+/* Periodic thread configuration and results */
+typedef struct {
+  osPriority_t prio;
+  uint32_t     ticks;                   /* Period [ticks]                 */
+  uint32_t     period;                  /* Period [timestamp cycles]      */
+  uint32_t     releases;                /* Releases after the first one   */
+  uint32_t     jitters;                 /* Jitter samples (back to back)  */
+  uint64_t     jitter_sum;              /* Sum of absolute jitter         */
+  uint32_t     jitter_max;              /* Maximum absolute jitter        */
+  int32_t      late_min;                /* Release offset range against   */
+  int32_t      late_max;                /*   the ideal release times      */
+  uint32_t     misses;                  /* Deadline misses                */
+} BENCH_PERIODIC;
+
+#if (TC_BENCH_EN)
+static BENCH_PERIODIC Bench_Periodic[BENCH_PERIODIC_CNT] = {
+  { osPriorityAboveNormal4,  1U, 0U, 0U, 0U, 0U, 0U, 0, 0, 0U },
+  { osPriorityAboveNormal2,  2U, 0U, 0U, 0U, 0U, 0U, 0, 0, 0U },
+  { osPriorityAboveNormal,   5U, 0U, 0U, 0U, 0U, 0U, 0, 0, 0U },
+  { osPriorityBelowNormal4, 10U, 0U, 0U, 0U, 0U, 0U, 0, 0, 0U }
+};
+
+static osThreadId_t      Bench_MainId;  /* Thread running the test case   */
+static volatile uint32_t Bench_Stop;    /* Threads exit                   */
+
+void Th_BenchPeriodic  (void *arg);
+void Th_BenchBurstLoad (void *arg);
+void Th_BenchSpinLoad  (void *arg);
+void Bench_DelayUntilRun (uint32_t load);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchDelayUntil
+\details
+- Run four periodic threads built on osDelayUntil(next += period) for BENCH_TIMER_TICKS ticks:
+  - osPriorityAboveNormal4 with 1 tick period
+  - osPriorityAboveNormal2 with 2 ticks period
+  - osPriorityAboveNormal with 5 ticks period
+  - osPriorityBelowNormal4 with 10 ticks period
+- Report per thread:
+  - the average and maximum release jitter between back to back releases
+  - the release spread: latest minus earliest release offset against the ideal release times, which are
+    tick aligned to the first release (the tick edge itself is not visible to the timestamp counter)
+  - the deadline misses
+*/
+void TC_BenchDelayUntil (void) {
+#if (TC_BENCHDELAYUNTIL_EN)
+  Bench_DelayUntilRun (0U);
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchDelayUntilLoad
+\details
+- Run the periodic threads of TC_BenchDelayUntil with background load:
+  - an osPriorityAboveNormal1 thread executing random bursts of up to half a tick every 1 to 3 ticks
+  - an osPriorityLow thread executing continuously
+- Report per thread:
+  - the average and maximum release jitter between back to back releases
+  - the release spread: latest minus earliest release offset against the ideal release times, which are
+    tick aligned to the first release (the tick edge itself is not visible to the timestamp counter)
+  - the deadline misses
+*/
+void TC_BenchDelayUntilLoad (void) {
+#if (TC_BENCHDELAYUNTILLOAD_EN)
+  Bench_DelayUntilRun (1U);
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * Periodic thread: release on osDelayUntil and record release times
+ *----------------------------------------------------------------------------*/
+void Th_BenchPeriodic (void *arg) {
+  BENCH_PERIODIC *th = (BENCH_PERIODIC *)arg;
+  uint32_t next, next_ref, next_prev, tick, t, t_ref, t_prev, jitter;
+  int32_t  late;
+
+  tick      = th->period / th->ticks;
+  next      = osKernelGetTickCount();
+  next_ref  = next;
+  next_prev = next;
+  t_ref     = 0U;
+  t_prev    = 0U;
+
+  while (Bench_Stop == 0U) {
+    next += th->ticks;
+    if (osDelayUntil (next) != osOK) {
+      /* Release time already passed: skip to the current tick */
+      th->misses++;
+      next = osKernelGetTickCount();
+      continue;
+    }
+    t = BENCH_TIME();
+
+    if (th->releases == 0U) {
+      /* First release is the reference for the ideal release times */
+      t_ref    = t;
+      next_ref = next;
+    } else if ((next - next_prev) == th->ticks) {
+      /* Jitter between back to back releases only (not across a miss) */
+      jitter = t - t_prev;
+      jitter = (jitter > th->period) ? (jitter - th->period) : (th->period - jitter);
+      th->jitter_sum += jitter;
+      if (jitter > th->jitter_max) {
+        th->jitter_max = jitter;
+      }
+      th->jitters++;
+    }
+    /* Ideal release time of the release tick (skipped periods included) */
+    late = (int32_t)(t - (t_ref + ((next - next_ref) * tick)));
+    if (late < th->late_min) { th->late_min = late; }
+    if (late > th->late_max) { th->late_max = late; }
+    th->releases++;
+    t_prev    = t;
+    next_prev = next;
+
+    /* Deadline is the next release: count the miss here and skip to the current tick */
+    if ((osKernelGetTickCount() - next) >= th->ticks) {
+      th->misses++;
+      next = osKernelGetTickCount();
+    }
+  }
+
+  osThreadFlagsSet (Bench_MainId, 1UL << (th - Bench_Periodic));
+}
+
+/*-----------------------------------------------------------------------------
+ * Burst load: execute for a random part of half a tick every 1 to 3 ticks
+ *----------------------------------------------------------------------------*/
+void Th_BenchBurstLoad (void *arg) {
+  uint32_t half, t0, burst;
+  (void)arg;
+
+  half = (TS_GetTimestampFreq() / osKernelGetTickFreq()) / 2U;
+
+  while (Bench_Stop == 0U) {
+    osDelay (1U + (Bench_Random() % 3U));
+    burst = (half != 0U) ? (Bench_Random() % half) : 0U;
+    t0 = BENCH_TIME();
+    while (((BENCH_TIME() - t0) < burst) && (Bench_Stop == 0U));
+  }
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_BURST);
+}
+
+/*-----------------------------------------------------------------------------
+ * Spin load: execute continuously at low priority
+ *----------------------------------------------------------------------------*/
+void Th_BenchSpinLoad (void *arg) {
+  (void)arg;
+
+  while (Bench_Stop == 0U);
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_SPIN);
+}
+
+/*-----------------------------------------------------------------------------
+ * Run periodic threads with (load = 1) or without background load
+ *----------------------------------------------------------------------------*/
+void Bench_DelayUntilRun (uint32_t load) {
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityNormal, 0U, 0U};
+  const char *ctx = (load != 0U) ? "load" : "idle";
+  BENCH_PERIODIC *th;
+  osThreadId_t id;
+  uint32_t i, tick, wait, flags;
+
+  Bench_MainId = osThreadGetId();
+  Bench_Stop   = 0U;
+  Bench_RandomSeed (0U);
+  osThreadFlagsClear (0x00FFU);
+
+  tick = TS_GetTimestampFreq() / osKernelGetTickFreq();
+  wait = 0U;
+
+  if (load != 0U) {
+    attr.priority = osPriorityAboveNormal1;
+    id = osThreadNew (Th_BenchBurstLoad, NULL, &attr);
+    ASSERT_TRUE (id != NULL);
+    if (id != NULL) {
+      wait |= BENCH_FLAG_BURST;
+    }
+    attr.priority = osPriorityLow;
+    id = osThreadNew (Th_BenchSpinLoad, NULL, &attr);
+    ASSERT_TRUE (id != NULL);
+    if (id != NULL) {
+      wait |= BENCH_FLAG_SPIN;
+    }
+  }
+
+  for (i = 0U; i < BENCH_PERIODIC_CNT; i++) {
+    th = &Bench_Periodic[i];
+    th->period     = th->ticks * tick;
+    th->releases   = 0U;
+    th->jitters    = 0U;
+    th->jitter_sum = 0U;
+    th->jitter_max = 0U;
+    th->late_min   = INT32_MAX;
+    th->late_max   = INT32_MIN;
+    th->misses     = 0U;
+
+    attr.priority = th->prio;
+    id = osThreadNew (Th_BenchPeriodic, th, &attr);
+    ASSERT_TRUE (id != NULL);
+    if (id != NULL) {
+      wait |= 1UL << i;
+    }
+  }
+
+  osDelay (BENCH_TIMER_TICKS);
+  Bench_Stop = 1U;
+
+  /* Threads observe the stop request within their period */
+  flags = osThreadFlagsWait (wait, osFlagsWaitAll, 100U);
+  ASSERT_TRUE (((int32_t)flags >= 0) && ((flags & wait) == wait));
+
+  for (i = 0U; i < BENCH_PERIODIC_CNT; i++) {
+    th = &Bench_Periodic[i];
+    ASSERT_TRUE (th->releases > 1U);
+    if (th->releases > 1U) {
+      if (th->jitters != 0U) {
+        Bench_Value ((uint32_t)(th->jitter_sum / th->jitters), "cycles",
+                     "%s, %d ticks period, average jitter", ctx, th->ticks);
+        Bench_Value (th->jitter_max, "cycles",
+                     "%s, %d ticks period, maximum jitter", ctx, th->ticks);
+      }
+      Bench_Value ((uint32_t)(th->late_max - th->late_min), "cycles",
+                   "%s, %d ticks period, release spread", ctx, th->ticks);
+      Bench_Value (th->misses, "misses",
+                   "%s, %d ticks period, deadlines in %d releases", ctx, th->ticks, th->releases);
+    }
+  }
+}
+#endif
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_ISR
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_FLAG_WAKE   0x0001U       /* Flag set by the ISR            */
+#define BENCH_FLAG_DONE   0x0002U       /* Waiting thread completed       */
+
+/* Signaling primitive used by the ISR to wake the waiting thread */
+typedef enum {
+  BENCH_ISR_THREADFLAGS,
+  BENCH_ISR_EVENTFLAGS,
+  BENCH_ISR_SEMAPHORE,
+  BENCH_ISR_MESSAGEQUEUE,
+  BENCH_ISR_MEMORYPOOL
+} BENCH_ISR_WAKE;
+
+#if (TC_BENCH_EN)
+static BENCH_ISR_WAKE       Bench_Wake;     /* Primitive under test                */
+static osThreadId_t         Bench_MainId;   /* Thread running the test case        */
+static osThreadId_t         Bench_WaitId;   /* Thread woken by the ISR             */
+static osEventFlagsId_t     Bench_EfId;
+static osSemaphoreId_t      Bench_SemId;
+static osMessageQueueId_t   Bench_MqId;
+static osMemoryPoolId_t     Bench_MpId;
+static void * volatile      Bench_Block;    /* Memory block handed over by the ISR */
+static volatile uint32_t    Bench_Run;      /* Waiting thread is active            */
+static volatile uint32_t    Bench_Cnt;      /* Number of completed wake-ups        */
+static volatile uint32_t    Bench_TPend;    /* Timestamp before SetPendingIRQ      */
+static volatile uint32_t    Bench_TIsr;     /* Timestamp at ISR entry              */
+static volatile int32_t     Bench_IsrStat;  /* Status of the ISR service call      */
+
+/* Latency from SetPendingIRQ to ISR entry and from ISR entry to woken thread */
+static uint32_t Bench_IsrEntry[BENCH_SAMPLE_CNT];
+static uint32_t Bench_IsrWake [BENCH_SAMPLE_CNT];
+
+void Irq_BenchIsrWake (void);
+void Th_BenchIsrWait  (void *arg);
+void Bench_IsrWakeRun (BENCH_ISR_WAKE wake, const char *name);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchIsrThreadFlags
+\details
+- Wake a higher priority thread waiting for a thread flag with osThreadFlagsSet from the ISR
+- Measure the latency from SetPendingIRQ to ISR entry, from ISR entry to the woken thread and the total latency
+*/
+void TC_BenchIsrThreadFlags (void) {
+#if (TC_BENCHISRTHREADFLAGS_EN)
+  Bench_IsrWakeRun (BENCH_ISR_THREADFLAGS, "osThreadFlagsSet");
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchIsrEventFlags
+\details
+- Wake a higher priority thread waiting for an event flag with osEventFlagsSet from the ISR
+- Measure the latency from SetPendingIRQ to ISR entry, from ISR entry to the woken thread and the total latency
+*/
+void TC_BenchIsrEventFlags (void) {
+#if (TC_BENCHISREVENTFLAGS_EN)
+  Bench_EfId = osEventFlagsNew (NULL);
+  ASSERT_TRUE (Bench_EfId != NULL);
+
+  if (Bench_EfId != NULL) {
+    Bench_IsrWakeRun (BENCH_ISR_EVENTFLAGS, "osEventFlagsSet");
+    ASSERT_TRUE (osEventFlagsDelete (Bench_EfId) == osOK);
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchIsrSemaphore
+\details
+- Wake a higher priority thread waiting for a semaphore token with osSemaphoreRelease from the ISR
+- Measure the latency from SetPendingIRQ to ISR entry, from ISR entry to the woken thread and the total latency
+*/
+void TC_BenchIsrSemaphore (void) {
+#if (TC_BENCHISRSEMAPHORE_EN)
+  Bench_SemId = osSemaphoreNew (1U, 0U, NULL);
+  ASSERT_TRUE (Bench_SemId != NULL);
+
+  if (Bench_SemId != NULL) {
+    Bench_IsrWakeRun (BENCH_ISR_SEMAPHORE, "osSemaphoreRelease");
+    ASSERT_TRUE (osSemaphoreDelete (Bench_SemId) == osOK);
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchIsrMessageQueue
+\details
+- Wake a higher priority thread waiting for a message with osMessageQueuePut from the ISR
+- Measure the latency from SetPendingIRQ to ISR entry, from ISR entry to the woken thread and the total latency
+*/
+void TC_BenchIsrMessageQueue (void) {
+#if (TC_BENCHISRMESSAGEQUEUE_EN)
+  Bench_MqId = osMessageQueueNew (1U, sizeof(uint32_t), NULL);
+  ASSERT_TRUE (Bench_MqId != NULL);
+
+  if (Bench_MqId != NULL) {
+    Bench_IsrWakeRun (BENCH_ISR_MESSAGEQUEUE, "osMessageQueuePut");
+    ASSERT_TRUE (osMessageQueueDelete (Bench_MqId) == osOK);
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchIsrMemoryPool
+\details
+- Wake a higher priority thread waiting to allocate from an exhausted memory pool with osMemoryPoolFree from the ISR
+  (the freed block is handed over to the waiting thread)
+- Measure the latency from SetPendingIRQ to ISR entry, from ISR entry to the woken thread and the total latency
+*/
+void TC_BenchIsrMemoryPool (void) {
+#if (TC_BENCHISRMEMORYPOOL_EN)
+  Bench_MpId = osMemoryPoolNew (1U, sizeof(uint32_t), NULL);
+  ASSERT_TRUE (Bench_MpId != NULL);
+
+  if (Bench_MpId != NULL) {
+    Bench_IsrWakeRun (BENCH_ISR_MEMORYPOOL, "osMemoryPoolFree");
+    ASSERT_TRUE (osMemoryPoolDelete (Bench_MpId) == osOK);
+  }
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * ISR: take entry timestamp and wake the waiting thread
+ *----------------------------------------------------------------------------*/
+void Irq_BenchIsrWake (void) {
+  uint32_t msg = 0U;
+
+  Bench_TIsr = BENCH_TIME();
+
+  switch (Bench_Wake) {
+    case BENCH_ISR_THREADFLAGS:
+      Bench_IsrStat = ((int32_t)osThreadFlagsSet (Bench_WaitId, BENCH_FLAG_WAKE) < 0) ? osError : osOK;
+      break;
+    case BENCH_ISR_EVENTFLAGS:
+      Bench_IsrStat = ((int32_t)osEventFlagsSet (Bench_EfId, BENCH_FLAG_WAKE) < 0) ? osError : osOK;
+      break;
+    case BENCH_ISR_SEMAPHORE:
+      Bench_IsrStat = osSemaphoreRelease (Bench_SemId);
+      break;
+    case BENCH_ISR_MESSAGEQUEUE:
+      Bench_IsrStat = osMessageQueuePut (Bench_MqId, &msg, 0U, 0U);
+      break;
+    case BENCH_ISR_MEMORYPOOL:
+      Bench_IsrStat = osMemoryPoolFree (Bench_MpId, Bench_Block);
+      break;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Waiting thread: block on the primitive and take wake-up timestamp
+ *----------------------------------------------------------------------------*/
+void Th_BenchIsrWait (void *arg) {
+  osStatus_t stat;
+  uint32_t   t, msg;
+  (void)arg;
+
+  if (Bench_Wake == BENCH_ISR_MEMORYPOOL) {
+    /* Exhaust the pool, the ISR returns the block */
+    Bench_Block = osMemoryPoolAlloc (Bench_MpId, 0U);
+    if (Bench_Block == NULL) {
+      Bench_Run = 0U;
+    }
+  }
+
+  while ((Bench_Run != 0U) && (Bench_Cnt < BENCH_SAMPLE_CNT)) {
+    switch (Bench_Wake) {
+      case BENCH_ISR_THREADFLAGS:
+        stat = (osThreadFlagsWait (BENCH_FLAG_WAKE, osFlagsWaitAny, osWaitForever) == BENCH_FLAG_WAKE) ? osOK : osError;
+        break;
+      case BENCH_ISR_EVENTFLAGS:
+        stat = (osEventFlagsWait (Bench_EfId, BENCH_FLAG_WAKE, osFlagsWaitAny, osWaitForever) == BENCH_FLAG_WAKE) ? osOK : osError;
+        break;
+      case BENCH_ISR_SEMAPHORE:
+        stat = osSemaphoreAcquire (Bench_SemId, osWaitForever);
+        break;
+      case BENCH_ISR_MESSAGEQUEUE:
+        stat = osMessageQueueGet (Bench_MqId, &msg, NULL, osWaitForever);
+        break;
+      case BENCH_ISR_MEMORYPOOL:
+        Bench_Block = osMemoryPoolAlloc (Bench_MpId, osWaitForever);
+        stat = (Bench_Block != NULL) ? osOK : osError;
+        break;
+      default:
+        stat = osError;
+        break;
+    }
+    t = BENCH_TIME();
+
+    if (stat != osOK) {
+      break;
+    }
+    Bench_IsrEntry[Bench_Cnt] = Bench_TIsr - Bench_TPend;
+    Bench_IsrWake [Bench_Cnt] = t - Bench_TIsr;
+    Bench_Cnt++;
+  }
+
+  if ((Bench_Wake == BENCH_ISR_MEMORYPOOL) && (Bench_Block != NULL)) {
+    osMemoryPoolFree (Bench_MpId, Bench_Block);
+  }
+
+  Bench_Run = 0U;
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_DONE);
+}
+
+/*-----------------------------------------------------------------------------
+ * Run ISR to thread wake-up measurement and report the latencies
+ *----------------------------------------------------------------------------*/
+void Bench_IsrWakeRun (BENCH_ISR_WAKE wake, const char *name) {
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityAboveNormal, 0U, 0U};
+  uint32_t i;
+
+  TST_IRQHandler = Irq_BenchIsrWake;
+
+  Bench_Wake    = wake;
+  Bench_MainId  = osThreadGetId();
+  Bench_Run     = 1U;
+  Bench_Cnt     = 0U;
+  Bench_IsrStat = osOK;
+  osThreadFlagsClear (BENCH_FLAG_DONE);
+
+  /* Waiting thread runs until it blocks on the primitive */
+  Bench_WaitId = osThreadNew (Th_BenchIsrWait, NULL, &attr);
+  ASSERT_TRUE (Bench_WaitId != NULL);
+
+  if (Bench_WaitId != NULL) {
+    for (i = 0U; (i < BENCH_SAMPLE_CNT) && (Bench_Run != 0U); i++) {
+      Bench_TPend = BENCH_TIME();
+      SetPendingIRQ (IRQ_A);
+      if (Bench_IsrStat != osOK) {
+        break;
+      }
+    }
+    ASSERT_TRUE (Bench_IsrStat == osOK);
+
+    if (osThreadFlagsWait (BENCH_FLAG_DONE, osFlagsWaitAny, 100U) != BENCH_FLAG_DONE) {
+      /* Waiting thread was not released */
+      osThreadTerminate (Bench_WaitId);
+    }
+  }
+
+  ASSERT_TRUE (Bench_Cnt == BENCH_SAMPLE_CNT);
+
+  Bench_Start();
+  for (i = 0U; i < Bench_Cnt; i++) {
+    Bench_Sample (Bench_IsrEntry[i]);
+  }
+  Bench_Report ("%s: SetPendingIRQ to ISR entry", name);
+  for (i = 0U; i < Bench_Cnt; i++) {
+    Bench_Sample (Bench_IsrWake[i]);
+  }
+  Bench_Report ("%s: ISR entry to thread", name);
+  for (i = 0U; i < Bench_Cnt; i++) {
+    Bench_Sample (Bench_IsrEntry[i] + Bench_IsrWake[i]);
+  }
+  Bench_Report ("%s: SetPendingIRQ to thread", name);
+}
+#endif
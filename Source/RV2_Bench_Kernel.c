@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_KERNEL
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_KERNEL_LOOP 32U           /* Calls per sample               */
+
+/* Measured kernel service */
+typedef enum {
+  BENCH_KERNEL_EMPTY,                   /* Loop overhead calibration      */
+  BENCH_KERNEL_LOCK_UNLOCK,             /* osKernelLock, osKernelUnlock   */
+  BENCH_KERNEL_LOCK_RESTORE,            /* osKernelLock, osKernelRestoreLock */
+  BENCH_KERNEL_TICK,                    /* osKernelGetTickCount           */
+  BENCH_KERNEL_SYSTIMER,                /* osKernelGetSysTimerCount       */
+  BENCH_KERNEL_OP_NUM
+} BENCH_KERNEL_OP;
+
+#if (TC_BENCH_EN)
+static const char * const Bench_OpName[BENCH_KERNEL_OP_NUM] = {
+  "empty loop",
+  "osKernelLock/Unlock",
+  "osKernelLock/RestoreLock",
+  "osKernelGetTickCount",
+  "osKernelGetSysTimerCount"
+};
+
+static volatile uint32_t Bench_Sink;    /* Loop body store                */
+static BENCH_KERNEL_OP   Bench_Op;      /* Service measured by the ISR    */
+static volatile uint32_t Bench_IsrCyc;  /* Loop time measured by the ISR  */
+
+void     Irq_BenchKernel  (void);
+uint32_t Bench_KernelLoop (BENCH_KERNEL_OP op);
+void     Bench_KernelRun  (uint32_t isr, BENCH_KERNEL_OP first);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchKernelThread
+\details
+- Calibrate the loop overhead with an empty loop of 32 iterations
+- Measure loops of 32 calls from thread context for:
+  - osKernelLock and osKernelUnlock
+  - osKernelLock and osKernelRestoreLock
+  - osKernelGetTickCount
+  - osKernelGetSysTimerCount
+- Report the cost per call (per pair for the lock services) with the loop overhead removed
+*/
+void TC_BenchKernelThread (void) {
+#if (TC_BENCHKERNELTHREAD_EN)
+  Bench_KernelRun (0U, BENCH_KERNEL_LOCK_UNLOCK);
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchKernelIsr
+\details
+- Calibrate the loop overhead with an empty loop of 32 iterations in the ISR
+- Measure loops of 32 calls in the ISR for osKernelGetTickCount and osKernelGetSysTimerCount
+  (kernel lock services are not callable from an ISR)
+- Report the cost per call with the loop overhead removed
+*/
+void TC_BenchKernelIsr (void) {
+#if (TC_BENCHKERNELISR_EN)
+  Bench_KernelRun (1U, BENCH_KERNEL_TICK);
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * ISR: measure one loop of the selected service
+ *----------------------------------------------------------------------------*/
+void Irq_BenchKernel (void) {
+  Bench_IsrCyc = Bench_KernelLoop (Bench_Op);
+}
+
+/*-----------------------------------------------------------------------------
+ * Call the service BENCH_KERNEL_LOOP times, returns elapsed timestamp cycles
+ *----------------------------------------------------------------------------*/
+uint32_t Bench_KernelLoop (BENCH_KERNEL_OP op) {
+  uint32_t i, t0, t1;
+  int32_t  lock;
+
+  t0 = BENCH_TIME();
+  switch (op) {
+    case BENCH_KERNEL_EMPTY:
+      for (i = 0U; i < BENCH_KERNEL_LOOP; i++) {
+        Bench_Sink = i;
+      }
+      break;
+
+    case BENCH_KERNEL_LOCK_UNLOCK:
+      for (i = 0U; i < BENCH_KERNEL_LOOP; i++) {
+        osKernelLock();
+        Bench_Sink = (uint32_t)osKernelUnlock();
+      }
+      break;
+
+    case BENCH_KERNEL_LOCK_RESTORE:
+      for (i = 0U; i < BENCH_KERNEL_LOOP; i++) {
+        lock = osKernelLock();
+        Bench_Sink = (uint32_t)osKernelRestoreLock (lock);
+      }
+      break;
+
+    case BENCH_KERNEL_TICK:
+      for (i = 0U; i < BENCH_KERNEL_LOOP; i++) {
+        Bench_Sink = osKernelGetTickCount();
+      }
+      break;
+
+    default:
+      for (i = 0U; i < BENCH_KERNEL_LOOP; i++) {
+        Bench_Sink = osKernelGetSysTimerCount();
+      }
+      break;
+  }
+  t1 = BENCH_TIME();
+
+  return (t1 - t0);
+}
+
+/*-----------------------------------------------------------------------------
+ * Measure services from first to the last one in thread (isr = 0) or ISR context
+ *----------------------------------------------------------------------------*/
+void Bench_KernelRun (uint32_t isr, BENCH_KERNEL_OP first) {
+  const char *ctx = (isr != 0U) ? "ISR" : "thread";
+  uint32_t op, i, cyc, cal;
+
+  TST_IRQHandler = Irq_BenchKernel;
+
+  cal = UINT32_MAX;
+  for (op = BENCH_KERNEL_EMPTY; op < BENCH_KERNEL_OP_NUM; op++) {
+    if ((op != BENCH_KERNEL_EMPTY) && (op < first)) {
+      continue;
+    }
+    Bench_Start();
+
+    for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+      if (isr != 0U) {
+        Bench_Op     = (BENCH_KERNEL_OP)op;
+        Bench_IsrCyc = 0U;
+        SetPendingIRQ (IRQ_A);
+        cyc = Bench_IsrCyc;
+      } else {
+        cyc = Bench_KernelLoop ((BENCH_KERNEL_OP)op);
+      }
+
+      if (op == BENCH_KERNEL_EMPTY) {
+        /* Minimum loop time is the loop overhead */
+        if (cyc < cal) {
+          cal = cyc;
+        }
+        Bench_Sample (cyc);
+      } else {
+        Bench_Sample (((cyc > cal) ? (cyc - cal) : 0U) / BENCH_KERNEL_LOOP);
+      }
+    }
+
+    if (op == BENCH_KERNEL_EMPTY) {
+      Bench_Report ("%s, %s, %d iterations", ctx, Bench_OpName[op], BENCH_KERNEL_LOOP);
+    } else {
+      Bench_Report ("%s, %s per %s", ctx, Bench_OpName[op], (op <= BENCH_KERNEL_LOCK_RESTORE) ? "pair" : "call");
+    }
+  }
+
+  /* Kernel is unlocked after the measurement */
+  ASSERT_TRUE (osKernelGetState() == osKernelRunning);
+}
+#endif
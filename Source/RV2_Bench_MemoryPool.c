@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_MEMORYPOOL
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_MPOOL_MIN_CNT   16U       /* Smallest memory pool [blocks]  */
+#define BENCH_MPOOL_ROUNDS    2U        /* Pattern repetitions per pool   */
+#define BENCH_MPOOL_SEED      0xAA55AA55U
+
+/* Allocation and release order */
+typedef enum {
+  BENCH_MPOOL_SEQUENTIAL,               /* Free in allocation order       */
+  BENCH_MPOOL_LIFO,                     /* Free in reverse order          */
+  BENCH_MPOOL_RANDOM,                   /* Random alloc/free mix          */
+  BENCH_MPOOL_PATTERN_NUM
+} BENCH_MPOOL_PATTERN;
+
+/* Accumulated cost of one operation type */
+typedef struct {
+  uint64_t sum;
+  uint32_t cnt;
+} BENCH_MPOOL_COST;
+
+#if (TC_BENCH_EN)
+static const char * const Bench_PatternName[BENCH_MPOOL_PATTERN_NUM] = {
+  "sequential", "LIFO", "random"
+};
+
+static osMemoryPoolId_t    Bench_MpId;
+static BENCH_MPOOL_PATTERN Bench_Pattern;         /* Pattern run by the ISR        */
+static uint32_t            Bench_BlockCnt;        /* Blocks in the memory pool     */
+static volatile uint32_t   Bench_Errors;          /* Failed operations             */
+static BENCH_MPOOL_COST    Bench_Alloc;
+static BENCH_MPOOL_COST    Bench_Free;
+static void               *Bench_Blk[BENCH_MPOOL_BLOCK_CNT];
+
+void     Irq_BenchMemPool   (void);
+uint32_t Bench_MemPoolOp    (uint32_t i);
+uint32_t Bench_MemPoolRun   (BENCH_MPOOL_PATTERN pattern, uint32_t n);
+void     Bench_MemPoolSweep (uint32_t isr);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMemPoolThread
+\details
+- Create memory pools with 16 blocks up to BENCH_MPOOL_BLOCK_CNT blocks of BENCH_MPOOL_BLOCK_SIZE bytes
+- Allocate and free all blocks in sequential, LIFO and random (LFSR driven) order from thread context
+- Report the average osMemoryPoolAlloc and osMemoryPoolFree cost per pool size and pattern
+- Report the cost in the largest pool relative to the smallest pool (100% for O(1) operations)
+*/
+void TC_BenchMemPoolThread (void) {
+#if (TC_BENCHMEMPOOLTHREAD_EN)
+  Bench_MemPoolSweep (0U);
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMemPoolIsr
+\details
+- Create memory pools with 16 blocks up to BENCH_MPOOL_BLOCK_CNT blocks of BENCH_MPOOL_BLOCK_SIZE bytes
+- Allocate and free all blocks in sequential, LIFO and random (LFSR driven) order from the ISR
+- Report the average osMemoryPoolAlloc and osMemoryPoolFree cost per pool size and pattern
+- Report the cost in the largest pool relative to the smallest pool (100% for O(1) operations)
+*/
+void TC_BenchMemPoolIsr (void) {
+#if (TC_BENCHMEMPOOLISR_EN)
+  Bench_MemPoolSweep (1U);
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * ISR: run the selected pattern on the memory pool
+ *----------------------------------------------------------------------------*/
+void Irq_BenchMemPool (void) {
+  Bench_Errors = Bench_MemPoolRun (Bench_Pattern, Bench_BlockCnt);
+}
+
+/*-----------------------------------------------------------------------------
+ * Allocate (slot empty) or free (slot used) block in slot i and add its cost
+ *----------------------------------------------------------------------------*/
+uint32_t Bench_MemPoolOp (uint32_t i) {
+  uint32_t t0, t1, err = 0U;
+  osStatus_t stat;
+  void *blk;
+
+  if (Bench_Blk[i] == NULL) {
+    t0  = BENCH_TIME();
+    blk = osMemoryPoolAlloc (Bench_MpId, 0U);
+    t1  = BENCH_TIME();
+    if (blk != NULL) {
+      Bench_Blk[i] = blk;
+      Bench_Alloc.sum += t1 - t0;
+      Bench_Alloc.cnt++;
+    } else {
+      err = 1U;
+    }
+  } else {
+    t0   = BENCH_TIME();
+    stat = osMemoryPoolFree (Bench_MpId, Bench_Blk[i]);
+    t1   = BENCH_TIME();
+    if (stat == osOK) {
+      Bench_Blk[i] = NULL;
+      Bench_Free.sum += t1 - t0;
+      Bench_Free.cnt++;
+    } else {
+      err = 1U;
+    }
+  }
+  return (err);
+}
+
+/*-----------------------------------------------------------------------------
+ * Allocate and free n blocks in the given order, returns number of failed operations
+ *----------------------------------------------------------------------------*/
+uint32_t Bench_MemPoolRun (BENCH_MPOOL_PATTERN pattern, uint32_t n) {
+  uint32_t r, i, err = 0U;
+
+  for (r = 0U; r < BENCH_MPOOL_ROUNDS; r++) {
+    switch (pattern) {
+      case BENCH_MPOOL_SEQUENTIAL:
+        for (i = 0U; i < n; i++) {
+          err += Bench_MemPoolOp (i);
+        }
+        for (i = 0U; i < n; i++) {
+          err += Bench_MemPoolOp (i);
+        }
+        break;
+
+      case BENCH_MPOOL_LIFO:
+        for (i = 0U; i < n; i++) {
+          err += Bench_MemPoolOp (i);
+        }
+        for (i = n; i > 0U; i--) {
+          err += Bench_MemPoolOp (i - 1U);
+        }
+        break;
+
+      default:
+        /* Toggle random slots, then free the remaining blocks */
+        for (i = 0U; i < (4U * n); i++) {
+          err += Bench_MemPoolOp (Bench_Random() % n);
+        }
+        for (i = 0U; i < n; i++) {
+          if (Bench_Blk[i] != NULL) {
+            err += Bench_MemPoolOp (i);
+          }
+        }
+        break;
+    }
+  }
+  return (err);
+}
+
+/*-----------------------------------------------------------------------------
+ * Run all patterns on all pool sizes from thread (isr = 0) or ISR context
+ *----------------------------------------------------------------------------*/
+void Bench_MemPoolSweep (uint32_t isr) {
+  const char *ctx = (isr != 0U) ? "ISR" : "thread";
+  uint32_t p, n, i, first;
+  uint32_t avg_alloc[BENCH_MPOOL_PATTERN_NUM][2] = {{0U}};
+  uint32_t avg_free [BENCH_MPOOL_PATTERN_NUM][2] = {{0U}};
+
+  TST_IRQHandler = Irq_BenchMemPool;
+  first = 1U;
+
+  for (n = BENCH_MPOOL_MIN_CNT; n <= BENCH_MPOOL_BLOCK_CNT; n *= 4U) {
+    Bench_MpId = osMemoryPoolNew (n, BENCH_MPOOL_BLOCK_SIZE, NULL);
+    ASSERT_TRUE (Bench_MpId != NULL);
+    if (Bench_MpId == NULL) {
+      break;
+    }
+
+    for (p = 0U; p < BENCH_MPOOL_PATTERN_NUM; p++) {
+      for (i = 0U; i < n; i++) {
+        Bench_Blk[i] = NULL;
+      }
+      Bench_Alloc.sum = 0U;
+      Bench_Alloc.cnt = 0U;
+      Bench_Free.sum  = 0U;
+      Bench_Free.cnt  = 0U;
+      Bench_RandomSeed (BENCH_MPOOL_SEED);
+
+      if (isr != 0U) {
+        Bench_Pattern  = (BENCH_MPOOL_PATTERN)p;
+        Bench_BlockCnt = n;
+        Bench_Errors   = UINT32_MAX;
+        SetPendingIRQ (IRQ_A);
+      } else {
+        Bench_Errors = Bench_MemPoolRun ((BENCH_MPOOL_PATTERN)p, n);
+      }
+      ASSERT_TRUE (Bench_Errors == 0U);
+      ASSERT_TRUE (osMemoryPoolGetCount (Bench_MpId) == 0U);
+
+      if ((Bench_Alloc.cnt != 0U) && (Bench_Free.cnt != 0U)) {
+        avg_alloc[p][1] = (uint32_t)(Bench_Alloc.sum / Bench_Alloc.cnt);
+        avg_free [p][1] = (uint32_t)(Bench_Free.sum  / Bench_Free.cnt);
+        if (first != 0U) {
+          avg_alloc[p][0] = avg_alloc[p][1];
+          avg_free [p][0] = avg_free [p][1];
+        }
+        Bench_Value (avg_alloc[p][1], "cycles", "%s alloc %d blocks, %s", ctx, n, Bench_PatternName[p]);
+        Bench_Value (avg_free [p][1], "cycles", "%s free %d blocks, %s",  ctx, n, Bench_PatternName[p]);
+      }
+    }
+    first = 0U;
+
+    ASSERT_TRUE (osMemoryPoolDelete (Bench_MpId) == osOK);
+
+    if (n > (BENCH_MPOOL_BLOCK_CNT / 4U)) {
+      /* Next pool size exceeds BENCH_MPOOL_BLOCK_CNT */
+      break;
+    }
+  }
+
+  /* Scaling from the smallest to the largest pool, 100% when cost is independent of pool size */
+  if ((first == 0U) && (n > BENCH_MPOOL_MIN_CNT)) {
+    for (p = 0U; p < BENCH_MPOOL_PATTERN_NUM; p++) {
+      if (avg_alloc[p][0] != 0U) {
+        Bench_Value ((avg_alloc[p][1] * 100U) / avg_alloc[p][0], "%",
+                     "%s alloc %d vs %d blocks, %s", ctx, n, BENCH_MPOOL_MIN_CNT, Bench_PatternName[p]);
+      }
+      if (avg_free[p][0] != 0U) {
+        Bench_Value ((avg_free[p][1] * 100U) / avg_free[p][0], "%",
+                     "%s free %d vs %d blocks, %s", ctx, n, BENCH_MPOOL_MIN_CNT, Bench_PatternName[p]);
+      }
+    }
+  }
+}
+#endif
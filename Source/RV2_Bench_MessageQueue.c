@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_MESSAGEQUEUE
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_FLAG_DONE   0x0001U       /* Consumer thread completed      */
+
+#define BENCH_MSGQ_SZ_MAX  512U         /* Largest message size [bytes]   */
+#define BENCH_MSGQ_LAT_CNT 16U          /* Queue depth for latency test   */
+
+/* Number of messages transferred per throughput measurement */
+#define BENCH_MSGQ_MSGS   (4U * BENCH_SAMPLE_CNT)
+
+/* Transfer direction */
+typedef enum {
+  BENCH_MSGQ_THREAD,                    /* Thread to thread               */
+  BENCH_MSGQ_ISR_PUT,                   /* ISR to thread                  */
+  BENCH_MSGQ_ISR_GET                    /* Thread to ISR                  */
+} BENCH_MSGQ_MODE;
+
+#if (TC_BENCH_EN)
+static const uint32_t Bench_MsgSize[]  = { 4U, 16U, 64U, 256U, BENCH_MSGQ_SZ_MAX };
+static const uint32_t Bench_MsgDepth[] = { 1U, 16U, 256U };
+
+static osMessageQueueId_t Bench_MqId;
+static osThreadId_t       Bench_MainId;       /* Thread running the test case      */
+static BENCH_MSGQ_MODE    Bench_Mode;
+static volatile uint32_t  Bench_Remain;       /* Messages left for the ISR         */
+static volatile uint32_t  Bench_IsrCnt;       /* Messages transferred in the ISR   */
+static volatile uint32_t  Bench_IsrCyc;       /* ISR cycles spent in put or get    */
+
+static uint32_t Bench_TxBuf [BENCH_MSGQ_SZ_MAX / 4U];
+static uint32_t Bench_RxBuf [BENCH_MSGQ_SZ_MAX / 4U];
+static uint32_t Bench_IsrBuf[BENCH_MSGQ_SZ_MAX / 4U];
+#endif
+
+void Irq_BenchMsgQ        (void);
+void Th_BenchMsgQConsumer (void *arg);
+void Bench_MsgQThroughput (BENCH_MSGQ_MODE mode, const char *name);
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMsgQLatency
+\details
+- Create message queues with message sizes of 4, 16, 64, 256 and 512 bytes
+- Measure osMessageQueuePut into a queue with free space and osMessageQueueGet from a queue with messages
+- Report the copy rate (bytes per 1000 cycles) derived from the latency increase over the 4 byte message
+*/
+void TC_BenchMsgQLatency (void) {
+#if (TC_BENCHMSGQLATENCY_EN)
+  uint32_t s, i, k, depth, t0, t1, put, get, base;
+  osStatus_t stat;
+
+  base = 0U;
+  for (s = 0U; s < (sizeof(Bench_MsgSize) / sizeof(Bench_MsgSize[0])); s++) {
+    depth = BENCH_MSGQ_LAT_CNT;
+    while ((depth > 1U) && ((Bench_MsgSize[s] * depth) > BENCH_MSGQ_MEM_SIZE)) {
+      depth /= 2U;
+    }
+    Bench_MqId = osMessageQueueNew (depth, Bench_MsgSize[s], NULL);
+    ASSERT_TRUE (Bench_MqId != NULL);
+    if (Bench_MqId == NULL) {
+      break;
+    }
+
+    /* Timed put, untimed get */
+    stat = osOK;
+    for (k = 0U; (k < BENCH_SAMPLE_CNT) && (stat == osOK); k += depth) {
+      for (i = 0U; i < depth; i++) {
+        t0   = BENCH_TIME();
+        stat = osMessageQueuePut (Bench_MqId, Bench_TxBuf, 0U, 0U);
+        t1   = BENCH_TIME();
+        Bench_Sample (t1 - t0);
+      }
+      while (osMessageQueueGet (Bench_MqId, Bench_RxBuf, NULL, 0U) == osOK);
+    }
+    ASSERT_TRUE (stat == osOK);
+    put = Bench_Report ("osMessageQueuePut %d bytes", Bench_MsgSize[s]);
+
+    /* Untimed put, timed get */
+    for (k = 0U; (k < BENCH_SAMPLE_CNT) && (stat == osOK); k += depth) {
+      while (osMessageQueuePut (Bench_MqId, Bench_TxBuf, 0U, 0U) == osOK);
+      for (i = 0U; i < depth; i++) {
+        t0   = BENCH_TIME();
+        stat = osMessageQueueGet (Bench_MqId, Bench_RxBuf, NULL, 0U);
+        t1   = BENCH_TIME();
+        Bench_Sample (t1 - t0);
+      }
+    }
+    ASSERT_TRUE (stat == osOK);
+    get = Bench_Report ("osMessageQueueGet %d bytes", Bench_MsgSize[s]);
+
+    if (s == 0U) {
+      base = put + get;
+    }
+    else if ((put + get) > base) {
+      /* Message is copied twice (put and get) */
+      Bench_Value ((2U * (Bench_MsgSize[s] - Bench_MsgSize[0]) * 1000U) / ((put + get) - base), "bytes/kcycle",
+                   "copy rate %d bytes", Bench_MsgSize[s]);
+    }
+
+    ASSERT_TRUE (osMessageQueueDelete (Bench_MqId) == osOK);
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMsgQThread
+\details
+- Create message queues for message sizes from 4 to 512 bytes and depths from 1 to 256 messages
+- Transfer messages from the test case thread to a consumer thread of equal priority
+- Report the number of messages per second
+*/
+void TC_BenchMsgQThread (void) {
+#if (TC_BENCHMSGQTHREAD_EN)
+  Bench_MsgQThroughput (BENCH_MSGQ_THREAD, "thread to thread");
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMsgQIsrToThread
+\details
+- Create message queues for message sizes from 4 to 512 bytes and depths from 1 to 256 messages
+- Put messages in the ISR until the queue is full, a higher priority consumer thread empties the queue
+- Report the number of messages per second and the cost of osMessageQueuePut in the ISR
+*/
+void TC_BenchMsgQIsrToThread (void) {
+#if (TC_BENCHMSGQISRTOTHREAD_EN)
+  Bench_MsgQThroughput (BENCH_MSGQ_ISR_PUT, "ISR to thread");
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMsgQThreadToIsr
+\details
+- Create message queues for message sizes from 4 to 512 bytes and depths from 1 to 256 messages
+- Fill the queue from the test case thread, the ISR empties the queue
+- Report the number of messages per second and the cost of osMessageQueueGet in the ISR
+*/
+void TC_BenchMsgQThreadToIsr (void) {
+#if (TC_BENCHMSGQTHREADTOISR_EN)
+  Bench_MsgQThroughput (BENCH_MSGQ_ISR_GET, "thread to ISR");
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * ISR: fill or empty the message queue
+ *----------------------------------------------------------------------------*/
+void Irq_BenchMsgQ (void) {
+  uint32_t t0, t1;
+
+  if (Bench_Mode == BENCH_MSGQ_ISR_PUT) {
+    while (Bench_Remain != 0U) {
+      t0 = BENCH_TIME();
+      if (osMessageQueuePut (Bench_MqId, Bench_IsrBuf, 0U, 0U) != osOK) {
+        break;
+      }
+      t1 = BENCH_TIME();
+      Bench_IsrCyc += t1 - t0;
+      Bench_IsrCnt++;
+      Bench_Remain--;
+    }
+  } else {
+    for (;;) {
+      t0 = BENCH_TIME();
+      if (osMessageQueueGet (Bench_MqId, Bench_IsrBuf, NULL, 0U) != osOK) {
+        break;
+      }
+      t1 = BENCH_TIME();
+      Bench_IsrCyc += t1 - t0;
+      Bench_IsrCnt++;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Consumer thread: receive the requested number of messages
+ *----------------------------------------------------------------------------*/
+void Th_BenchMsgQConsumer (void *arg) {
+  uint32_t i;
+  (void)arg;
+
+  for (i = 0U; i < BENCH_MSGQ_MSGS; i++) {
+    if (osMessageQueueGet (Bench_MqId, Bench_RxBuf, NULL, osWaitForever) != osOK) {
+      break;
+    }
+  }
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_DONE);
+}
+
+/*-----------------------------------------------------------------------------
+ * Transfer BENCH_MSGQ_MSGS messages for all sizes and depths
+ *----------------------------------------------------------------------------*/
+void Bench_MsgQThroughput (BENCH_MSGQ_MODE mode, const char *name) {
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityNormal, 0U, 0U};
+  const uint32_t cnt = BENCH_MSGQ_MSGS;
+  osThreadId_t id;
+  uint32_t s, d, i, t0, t1, flags;
+
+  TST_IRQHandler = Irq_BenchMsgQ;
+  Bench_MainId   = osThreadGetId();
+  Bench_Mode     = mode;
+
+  for (s = 0U; s < (sizeof(Bench_MsgSize) / sizeof(Bench_MsgSize[0])); s++) {
+    for (d = 0U; d < (sizeof(Bench_MsgDepth) / sizeof(Bench_MsgDepth[0])); d++) {
+      if ((Bench_MsgSize[s] * Bench_MsgDepth[d]) > BENCH_MSGQ_MEM_SIZE) {
+        /* Queue memory exceeds the configured limit */
+        continue;
+      }
+      Bench_MqId = osMessageQueueNew (Bench_MsgDepth[d], Bench_MsgSize[s], NULL);
+      ASSERT_TRUE (Bench_MqId != NULL);
+      if (Bench_MqId == NULL) {
+        return;
+      }
+      Bench_IsrCnt = 0U;
+      Bench_IsrCyc = 0U;
+      id = NULL;
+      i  = 0U;
+      osThreadFlagsClear (BENCH_FLAG_DONE);
+
+      t0 = BENCH_TIME();
+      if (mode == BENCH_MSGQ_THREAD) {
+        /* Consumer with equal priority runs when the queue is full */
+        attr.priority = osPriorityNormal;
+        id = osThreadNew (Th_BenchMsgQConsumer, NULL, &attr);
+        ASSERT_TRUE (id != NULL);
+        for (i = 0U; (id != NULL) && (i < cnt); i++) {
+          if (osMessageQueuePut (Bench_MqId, Bench_TxBuf, 0U, osWaitForever) != osOK) {
+            break;
+          }
+        }
+      }
+      else if (mode == BENCH_MSGQ_ISR_PUT) {
+        /* Consumer with higher priority runs after each interrupt */
+        attr.priority = osPriorityAboveNormal;
+        id = osThreadNew (Th_BenchMsgQConsumer, NULL, &attr);
+        ASSERT_TRUE (id != NULL);
+        Bench_Remain = cnt;
+        for (i = 0U; (id != NULL) && (Bench_Remain != 0U) && (i < cnt); i++) {
+          SetPendingIRQ (IRQ_A);
+        }
+        i = cnt - Bench_Remain;
+      }
+      else {
+        /* Fill the queue, interrupt empties it */
+        while (i < cnt) {
+          while ((i < cnt) && (osMessageQueuePut (Bench_MqId, Bench_TxBuf, 0U, 0U) == osOK)) {
+            i++;
+          }
+          SetPendingIRQ (IRQ_A);
+          if (osMessageQueueGetCount (Bench_MqId) != 0U) {
+            break;
+          }
+        }
+      }
+      if (id != NULL) {
+        flags = osThreadFlagsWait (BENCH_FLAG_DONE, osFlagsWaitAny, 100U);
+        ASSERT_TRUE (flags == BENCH_FLAG_DONE);
+        if (flags != BENCH_FLAG_DONE) {
+          osThreadTerminate (id);
+        }
+      }
+      t1 = BENCH_TIME();
+      ASSERT_TRUE (i == cnt);
+
+      if ((i == cnt) && (t1 != t0)) {
+        Bench_Value ((uint32_t)(((uint64_t)cnt * TS_GetTimestampFreq()) / (t1 - t0)), "msgs/s",
+                     "%s %d bytes depth %d", name, Bench_MsgSize[s], Bench_MsgDepth[d]);
+      }
+      if (Bench_IsrCnt != 0U) {
+        Bench_Value (Bench_IsrCyc / Bench_IsrCnt, "cycles",
+                     "%s %d bytes depth %d ISR %s", name, Bench_MsgSize[s], Bench_MsgDepth[d],
+                     (mode == BENCH_MSGQ_ISR_PUT) ? "put" : "get");
+      }
+
+      ASSERT_TRUE (osMessageQueueDelete (Bench_MqId) == osOK);
+    }
+  }
+}
+#endif
@@ -0,0 +1,464 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_MUTEX
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_FLAG_GO     0x0001U       /* Start next iteration           */
+#define BENCH_FLAG_READY  0x0002U       /* Low priority thread owns mutex */
+#define BENCH_FLAG_ITER   0x0004U       /* Iteration completed            */
+#define BENCH_FLAG_OWNER  0x0008U       /* Owner thread completed         */
+#define BENCH_FLAG_WAITER 0x0010U       /* Waiter thread completed        */
+
+/* Maximum recursive lock depth measured */
+#define BENCH_MUTEX_DEPTH ((MAX_MUTEX_LOCK_CNT < 64) ? MAX_MUTEX_LOCK_CNT : 64)
+
+/* Maximum priority inheritance chain depth (one priority level per owner) */
+#define BENCH_MUTEX_CHAIN 8U
+
+/* Priority inheritance chain owner */
+typedef struct {
+  osThreadId_t id;
+  osMutexId_t  own;                     /* Mutex held by the owner        */
+  osMutexId_t  next;                    /* Mutex waited for, NULL at the chain end */
+} BENCH_CHAIN;
+
+#if (TC_BENCH_EN)
+static osThreadId_t      Bench_MainId;  /* Thread running the test case      */
+static osMutexId_t       Bench_MutexId;
+static volatile uint32_t Bench_T0;      /* Timestamp before the measured call */
+static volatile uint32_t Bench_Boost;   /* Owner priority was raised         */
+#endif
+
+#if (TC_BENCHMUTEXINHERITCHAIN_EN)
+static BENCH_CHAIN       Bench_Chain[BENCH_MUTEX_CHAIN];
+static volatile uint32_t Bench_T1;      /* Timestamp before the chain end releases */
+static volatile uint32_t Bench_T2;      /* Timestamp after the top thread acquired */
+static volatile uint32_t Bench_TopCnt;  /* Top thread acquisitions           */
+static uint32_t          Bench_Unwind[BENCH_SAMPLE_CNT];
+static uint32_t          Bench_Block [BENCH_SAMPLE_CNT];
+#endif
+
+void Th_BenchMutexOwner  (void *arg);
+void Th_BenchMutexWaiter (void *arg);
+void Th_BenchMutexChain  (void *arg);
+void Th_BenchMutexTop    (void *arg);
+
+uint32_t Bench_MutexNest (uint32_t depth);
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMutexUncontended
+\details
+- Create mutexes with all combinations of osMutexRecursive, osMutexPrioInherit and osMutexRobust
+- Measure the uncontended osMutexAcquire and osMutexRelease pair for each combination
+*/
+void TC_BenchMutexUncontended (void) {
+#if (TC_BENCHMUTEXUNCONTENDED_EN)
+  osMutexAttr_t attr = {NULL, 0U, NULL, 0U};
+  osMutexId_t   id;
+  osStatus_t    stat;
+  uint32_t      i, n, t0, t1;
+
+  for (i = 0U; i < 8U; i++) {
+    attr.attr_bits = (((i & 1U) != 0U) ? osMutexRecursive   : 0U) |
+                     (((i & 2U) != 0U) ? osMutexPrioInherit : 0U) |
+                     (((i & 4U) != 0U) ? osMutexRobust      : 0U);
+    id = osMutexNew (&attr);
+    ASSERT_TRUE (id != NULL);
+
+    if (id != NULL) {
+      Bench_Start();
+
+      for (n = 0U; n < BENCH_SAMPLE_CNT; n++) {
+        t0   = BENCH_TIME();
+        stat = osMutexAcquire (id, 0U);
+        osMutexRelease (id);
+        t1   = BENCH_TIME();
+        if (stat != osOK) {
+          break;
+        }
+        Bench_Sample (t1 - t0);
+      }
+      ASSERT_TRUE (Bench_Count() == BENCH_SAMPLE_CNT);
+
+      Bench_Report ("osMutexAcquire/Release%s%s%s%s",
+                    (attr.attr_bits == 0U)                      ? " default"     : "",
+                    (attr.attr_bits & osMutexRecursive)   != 0U ? " Recursive"   : "",
+                    (attr.attr_bits & osMutexPrioInherit) != 0U ? " PrioInherit" : "",
+                    (attr.attr_bits & osMutexRobust)      != 0U ? " Robust"      : "");
+
+      ASSERT_TRUE (osMutexDelete (id) == osOK);
+    }
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMutexRecursive
+\details
+- Create a recursive mutex
+- Measure recursive acquisition and release for lock depths 1, 4, 16 and 64 (limited by MAX_MUTEX_LOCK_CNT)
+- Report the average cost per lock level
+*/
+void TC_BenchMutexRecursive (void) {
+#if (TC_BENCHMUTEXRECURSIVE_EN)
+  osMutexAttr_t attr = {NULL, osMutexRecursive, NULL, 0U};
+  uint32_t depth, i, t0, t1;
+  uint64_t sum;
+
+  Bench_MutexId = osMutexNew (&attr);
+  ASSERT_TRUE (Bench_MutexId != NULL);
+
+  if (Bench_MutexId != NULL) {
+    for (depth = 1U; depth <= BENCH_MUTEX_DEPTH; depth *= 4U) {
+      Bench_Start();
+      sum = 0U;
+
+      for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+        t0 = BENCH_TIME();
+        if (Bench_MutexNest (depth) != depth) {
+          break;
+        }
+        t1 = BENCH_TIME();
+        Bench_Sample (t1 - t0);
+        sum += t1 - t0;
+      }
+      ASSERT_TRUE (Bench_Count() == BENCH_SAMPLE_CNT);
+
+      Bench_Report ("osMutexAcquire/Release depth %d", depth);
+      if (i != 0U) {
+        Bench_Value ((uint32_t)(sum / ((uint64_t)i * depth)), "cycles", "depth %d average per lock level", depth);
+      }
+    }
+
+    /* Mutex is not owned after unwinding */
+    ASSERT_TRUE (osMutexGetOwner (Bench_MutexId) == NULL);
+    ASSERT_TRUE (osMutexDelete (Bench_MutexId) == osOK);
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMutexHandoff
+\details
+- Create a priority inheritance mutex owned by a low priority thread
+- Let a high priority thread block on the mutex (owner priority is raised)
+- Measure the time from osMutexRelease in the owner until osMutexAcquire returns in the high priority thread
+*/
+void TC_BenchMutexHandoff (void) {
+#if (TC_BENCHMUTEXHANDOFF_EN)
+  osThreadAttr_t tattr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityBelowNormal, 0U, 0U};
+  osMutexAttr_t  mattr = {NULL, osMutexPrioInherit, NULL, 0U};
+  osThreadId_t   owner, waiter;
+  uint32_t i, flags;
+
+  Bench_MainId  = osThreadGetId();
+  Bench_Boost   = 0U;
+  Bench_MutexId = osMutexNew (&mattr);
+  ASSERT_TRUE (Bench_MutexId != NULL);
+
+  if (Bench_MutexId != NULL) {
+    Bench_Start();
+    osThreadFlagsClear (BENCH_FLAG_READY | BENCH_FLAG_ITER | BENCH_FLAG_OWNER | BENCH_FLAG_WAITER);
+
+    owner = osThreadNew (Th_BenchMutexOwner, NULL, &tattr);
+    ASSERT_TRUE (owner != NULL);
+    tattr.priority = osPriorityAboveNormal;
+    waiter = osThreadNew (Th_BenchMutexWaiter, NULL, &tattr);
+    ASSERT_TRUE (waiter != NULL);
+
+    if ((owner != NULL) && (waiter != NULL)) {
+      for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+        /* Owner acquires the mutex */
+        osThreadFlagsSet (owner, BENCH_FLAG_GO);
+        if (osThreadFlagsWait (BENCH_FLAG_READY, osFlagsWaitAny, 100U) != BENCH_FLAG_READY) {
+          break;
+        }
+        /* Waiter blocks, boosted owner releases and hands over the mutex */
+        osThreadFlagsSet (waiter, BENCH_FLAG_GO);
+        flags = osThreadFlagsWait (BENCH_FLAG_ITER, osFlagsWaitAny, 100U);
+        if (((int32_t)flags < 0) || ((flags & BENCH_FLAG_ITER) == 0U)) {
+          break;
+        }
+      }
+      ASSERT_TRUE (i == BENCH_SAMPLE_CNT);
+      ASSERT_TRUE (Bench_Boost == BENCH_SAMPLE_CNT);
+    }
+
+    /* Wait until both threads completed, remove them otherwise */
+    flags = osThreadFlagsWait (BENCH_FLAG_OWNER | BENCH_FLAG_WAITER, osFlagsWaitAll, 100U);
+    if ((int32_t)flags < 0) {
+      flags = osThreadFlagsClear (BENCH_FLAG_OWNER | BENCH_FLAG_WAITER);
+    }
+    if ((owner != NULL) && ((flags & BENCH_FLAG_OWNER) == 0U)) {
+      osThreadTerminate (owner);
+    }
+    if ((waiter != NULL) && ((flags & BENCH_FLAG_WAITER) == 0U)) {
+      osThreadTerminate (waiter);
+    }
+
+    ASSERT_TRUE (Bench_Count() == BENCH_SAMPLE_CNT);
+    Bench_Report ("osMutexRelease handoff to high priority waiter");
+
+    ASSERT_TRUE (osMutexDelete (Bench_MutexId) == osOK);
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchMutexInheritChain
+\details
+- Build priority inheritance chains of depth 1 to 8: owner thread i holds mutex i and blocks on mutex i + 1,
+  the owner at the chain end holds its mutex and waits for thread flags
+- Owners run at osPriorityAboveNormal and one level higher per step towards the chain start
+- Let an osPriorityHigh thread block on mutex 0 and release the chain end
+- For each depth measure:
+  - the priority boost, from osMutexAcquire in the top thread until the test case thread runs again: covers the
+    whole blocking part of osMutexAcquire (priority propagation along the chain and blocking the top thread)
+    plus the switch back to the test case thread, not the propagation alone
+  - the unwind, from osMutexRelease at the chain end until osMutexAcquire returns in the top thread
+  - the top thread blocking time as the sum of priority boost and unwind (the work of the test case thread
+    while the top thread is blocked is not included)
+- Report the number of owners raised to the top thread priority (transitive inheritance)
+*/
+void TC_BenchMutexInheritChain (void) {
+#if (TC_BENCHMUTEXINHERITCHAIN_EN)
+  osThreadAttr_t tattr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityHigh, 0U, 0U};
+  osMutexAttr_t  mattr = {NULL, osMutexPrioInherit, NULL, 0U};
+  osThreadId_t   top;
+  uint32_t depth, i, n, t, raised, min_raised;
+
+  top = osThreadNew (Th_BenchMutexTop, NULL, &tattr);
+  ASSERT_TRUE (top != NULL);
+  if (top == NULL) {
+    return;
+  }
+
+  for (depth = 1U; depth <= BENCH_MUTEX_CHAIN; depth++) {
+    /* Chain start has the highest owner priority */
+    for (n = 0U; n < depth; n++) {
+      Bench_Chain[n].own = osMutexNew (&mattr);
+      ASSERT_TRUE (Bench_Chain[n].own != NULL);
+      if (Bench_Chain[n].own == NULL) {
+        break;
+      }
+    }
+    for (i = 0U; i < n; i++) {
+      Bench_Chain[i].next = ((i + 1U) < n) ? Bench_Chain[i + 1U].own : NULL;
+      tattr.priority      = (osPriority_t)((uint32_t)osPriorityAboveNormal + (n - 1U - i));
+      Bench_Chain[i].id   = osThreadNew (Th_BenchMutexChain, &Bench_Chain[i], &tattr);
+      ASSERT_TRUE (Bench_Chain[i].id != NULL);
+      if (Bench_Chain[i].id == NULL) {
+        n = i;
+      }
+    }
+
+    if (n == depth) {
+      Bench_Start();
+      Bench_TopCnt = 0U;
+      min_raised     = depth;
+
+      for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+        /* Owners run above the test case thread and block from the chain end backwards */
+        for (n = depth; n > 0U; n--) {
+          osThreadFlagsSet (Bench_Chain[n - 1U].id, BENCH_FLAG_GO);
+        }
+
+        /* Top thread blocks on mutex 0 and raises the chain */
+        osThreadFlagsSet (top, BENCH_FLAG_GO);
+        t = BENCH_TIME() - Bench_T0;
+        Bench_Sample (t);
+
+        raised = 0U;
+        for (n = 0U; n < depth; n++) {
+          if (osThreadGetPriority (Bench_Chain[n].id) == osPriorityHigh) {
+            raised++;
+          }
+        }
+        if (raised < min_raised) {
+          min_raised = raised;
+        }
+
+        /* Chain end releases, the chain unwinds up to the top thread */
+        osThreadFlagsSet (Bench_Chain[depth - 1U].id, BENCH_FLAG_GO);
+        Bench_Unwind[i] = Bench_T2 - Bench_T1;
+        Bench_Block [i] = t + Bench_Unwind[i];
+      }
+      ASSERT_TRUE (Bench_TopCnt == BENCH_SAMPLE_CNT);
+
+      Bench_Report ("depth %d, priority boost", depth);
+      for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+        Bench_Sample (Bench_Unwind[i]);
+      }
+      Bench_Report ("depth %d, unwind", depth);
+      for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+        Bench_Sample (Bench_Block[i]);
+      }
+      Bench_Report ("depth %d, top thread blocking", depth);
+      Bench_Value (min_raised, "owners", "depth %d, raised to top priority", depth);
+    }
+
+    /* Owners wait for thread flags and hold no mutex */
+    for (i = 0U; i < n; i++) {
+      ASSERT_TRUE (osThreadTerminate (Bench_Chain[i].id) == osOK);
+    }
+    for (i = 0U; i < depth; i++) {
+      if (Bench_Chain[i].own != NULL) {
+        ASSERT_TRUE (osMutexDelete (Bench_Chain[i].own) == osOK);
+        Bench_Chain[i].own = NULL;
+      }
+    }
+    if (n != depth) {
+      break;
+    }
+  }
+
+  ASSERT_TRUE (osThreadTerminate (top) == osOK);
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+/*-----------------------------------------------------------------------------
+ * Recursive mutex acquisition, returns number of acquired levels
+ *----------------------------------------------------------------------------*/
+#if (TC_BENCHMUTEXRECURSIVE_EN)
+uint32_t Bench_MutexNest (uint32_t depth) {
+  uint32_t cnt = 0U;
+
+  if (osMutexAcquire (Bench_MutexId, 0U) == osOK) {
+    cnt = 1U;
+    if (depth > 1U) {
+      cnt += Bench_MutexNest (depth - 1U);
+    }
+    osMutexRelease (Bench_MutexId);
+  }
+  return (cnt);
+}
+#endif
+
+#if (TC_BENCHMUTEXHANDOFF_EN)
+/*-----------------------------------------------------------------------------
+ * Low priority mutex owner: acquire, wait for waiter and release
+ *----------------------------------------------------------------------------*/
+void Th_BenchMutexOwner (void *arg) {
+  uint32_t i;
+  (void)arg;
+
+  for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+    osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, osWaitForever);
+    if (osMutexAcquire (Bench_MutexId, osWaitForever) != osOK) {
+      break;
+    }
+    osThreadFlagsSet (Bench_MainId, BENCH_FLAG_READY);
+
+    /* Runs again when raised above the test case thread by the waiter */
+    if (osThreadGetPriority (osThreadGetId()) == osPriorityAboveNormal) {
+      Bench_Boost++;
+    }
+    Bench_T0 = BENCH_TIME();
+    osMutexRelease (Bench_MutexId);
+  }
+
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_OWNER);
+}
+
+/*-----------------------------------------------------------------------------
+ * High priority mutex waiter: measure mutex handoff
+ *----------------------------------------------------------------------------*/
+void Th_BenchMutexWaiter (void *arg) {
+  uint32_t i, t;
+  (void)arg;
+
+  for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+    osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, osWaitForever);
+    if (osMutexAcquire (Bench_MutexId, osWaitForever) != osOK) {
+      break;
+    }
+    t = BENCH_TIME();
+    Bench_Sample (t - Bench_T0);
+    osMutexRelease (Bench_MutexId);
+
+    osThreadFlagsSet (Bench_MainId, BENCH_FLAG_ITER);
+  }
+
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_WAITER);
+}
+#endif
+
+#if (TC_BENCHMUTEXINHERITCHAIN_EN)
+/*-----------------------------------------------------------------------------
+ * Chain owner: hold own mutex and block on the next one, or wait at the chain end
+ *----------------------------------------------------------------------------*/
+void Th_BenchMutexChain (void *arg) {
+  BENCH_CHAIN *ch = (BENCH_CHAIN *)arg;
+
+  for (;;) {
+    osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, osWaitForever);
+    if (osMutexAcquire (ch->own, osWaitForever) != osOK) {
+      continue;
+    }
+    if (ch->next != NULL) {
+      if (osMutexAcquire (ch->next, osWaitForever) == osOK) {
+        osMutexRelease (ch->next);
+      }
+    } else {
+      /* Raised by the top thread until the test case thread releases the chain */
+      osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, osWaitForever);
+      Bench_T1 = BENCH_TIME();
+    }
+    osMutexRelease (ch->own);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Top priority thread: block on the chain start
+ *----------------------------------------------------------------------------*/
+void Th_BenchMutexTop (void *arg) {
+  (void)arg;
+
+  for (;;) {
+    osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, osWaitForever);
+    Bench_T0 = BENCH_TIME();
+    if (osMutexAcquire (Bench_Chain[0].own, osWaitForever) == osOK) {
+      Bench_T2 = BENCH_TIME();
+      Bench_TopCnt++;
+      osMutexRelease (Bench_Chain[0].own);
+    }
+  }
+}
+#endif
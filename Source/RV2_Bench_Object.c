@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_OBJECT
+#include "RV2_Bench.h"
+#include "RV2_Common.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+
+/* RTOS object types */
+typedef enum {
+  BENCH_OBJ_THREAD,
+  BENCH_OBJ_TIMER,
+  BENCH_OBJ_EVENTFLAGS,
+  BENCH_OBJ_MUTEX,
+  BENCH_OBJ_SEMAPHORE,
+  BENCH_OBJ_MEMORYPOOL,
+  BENCH_OBJ_MESSAGEQUEUE,
+  BENCH_OBJ_NUM
+} BENCH_OBJ;
+
+#if (TC_BENCH_EN)
+/* Create and delete function names per object type */
+static const char * const Bench_ObjName[BENCH_OBJ_NUM][2] = {
+  { "osThreadNew",       "osThreadTerminate"   },
+  { "osTimerNew",        "osTimerDelete"       },
+  { "osEventFlagsNew",   "osEventFlagsDelete"  },
+  { "osMutexNew",        "osMutexDelete"       },
+  { "osSemaphoreNew",    "osSemaphoreDelete"   },
+  { "osMemoryPoolNew",   "osMemoryPoolDelete"  },
+  { "osMessageQueueNew", "osMessageQueueDelete"}
+};
+
+static void * volatile   Bench_Obj;     /* Object under test                 */
+static volatile uint32_t Bench_T0;      /* Timestamp before osThreadNew      */
+static volatile uint32_t Bench_T1;      /* Timestamp before osThreadExit     */
+static volatile uint32_t Bench_Run;     /* Thread executed                   */
+static uint32_t          Bench_Del[BENCH_SAMPLE_CNT];
+
+static osThreadAttr_t       Bench_ThAttr;
+static osTimerAttr_t        Bench_TimAttr = {NULL, 0U, NULL, 0U};
+static osEventFlagsAttr_t   Bench_EfAttr  = {NULL, 0U, NULL, 0U};
+static osMutexAttr_t        Bench_MutAttr = {NULL, 0U, NULL, 0U};
+static osSemaphoreAttr_t    Bench_SemAttr = {NULL, 0U, NULL, 0U};
+static osMemoryPoolAttr_t   Bench_MpAttr  = {NULL, 0U, NULL, 0U, NULL, 0U};
+static osMessageQueueAttr_t Bench_MqAttr  = {NULL, 0U, NULL, 0U, NULL, 0U};
+
+void       Th_BenchLifeExit  (void *arg);
+void       Th_BenchLifeIdle  (void *arg);
+void       Tim_BenchObject   (void *arg);
+void       Bench_ThreadAttr  (osThreadAttr_t *attr, uint32_t user, uint32_t join, osPriority_t prio);
+void       Bench_ObjAttr     (uint32_t user);
+uint32_t   Bench_ObjNew      (BENCH_OBJ type);
+osStatus_t Bench_ObjDelete   (BENCH_OBJ type);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchThreadLifecycle
+\details
+- Use kernel allocated memory and user provided Thread_CbMem/Thread_StackMem for joinable and detached threads
+- Measure the time from osThreadNew until a higher priority thread runs
+- Measure the time from osThreadExit until the creating thread continues and the total create, run and exit
+  (and join) cost
+- Measure osThreadTerminate of a ready thread
+- Measure the time from osThreadExit until osThreadJoin returns in the waiting thread (joinable threads)
+*/
+void TC_BenchThreadLifecycle (void) {
+#if (TC_BENCHTHREADLIFECYCLE_EN)
+  osThreadAttr_t attr;
+  osThreadId_t   id;
+  osStatus_t     stat;
+  uint32_t v, i, user, join, t0, t1, t2;
+  uint64_t exit_sum, spawn_sum;
+  const char *mem, *type;
+
+  for (v = 0U; v < 4U; v++) {
+    user = v & 1U;
+    join = v & 2U;
+    mem  = (user != 0U) ? "user memory"   : "kernel memory";
+    type = (join != 0U) ? "joinable"      : "detached";
+
+    /* Higher priority thread runs from osThreadNew and exits */
+    Bench_ThreadAttr (&attr, user, join, osPriorityAboveNormal);
+    Bench_Start();
+    exit_sum  = 0U;
+    spawn_sum = 0U;
+    for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+      Bench_Run = 0U;
+      t0 = BENCH_TIME();
+      Bench_T0 = t0;
+      id = osThreadNew (Th_BenchLifeExit, (void *)&Bench_T0, &attr);
+      t1 = BENCH_TIME();
+      if ((id == NULL) || (Bench_Run == 0U)) {
+        break;
+      }
+      if (join != 0U) {
+        if (osThreadJoin (id) != osOK) {
+          break;
+        }
+      }
+      t2 = BENCH_TIME();
+      exit_sum  += t1 - Bench_T1;
+      spawn_sum += t2 - t0;
+    }
+    ASSERT_TRUE (i == BENCH_SAMPLE_CNT);
+    Bench_Report ("osThreadNew to first run, %s, %s", mem, type);
+    if (i != 0U) {
+      Bench_Value ((uint32_t)(exit_sum  / i), "cycles", "osThreadExit to creator, %s, %s", mem, type);
+      Bench_Value ((uint32_t)(spawn_sum / i), "cycles", "spawn total, %s, %s", mem, type);
+    }
+
+    /* Lower priority thread is terminated before it runs */
+    Bench_ThreadAttr (&attr, user, join, osPriorityBelowNormal);
+    for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+      id = osThreadNew (Th_BenchLifeIdle, NULL, &attr);
+      if (id == NULL) {
+        break;
+      }
+      t0   = BENCH_TIME();
+      stat = osThreadTerminate (id);
+      t1   = BENCH_TIME();
+      if (stat != osOK) {
+        break;
+      }
+      if (join != 0U) {
+        if (osThreadJoin (id) != osOK) {
+          break;
+        }
+      }
+      Bench_Sample (t1 - t0);
+    }
+    ASSERT_TRUE (i == BENCH_SAMPLE_CNT);
+    Bench_Report ("osThreadTerminate, %s, %s", mem, type);
+
+    /* Lower priority thread runs when the creator blocks in osThreadJoin */
+    if (join != 0U) {
+      for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+        Bench_Run = 0U;
+        id = osThreadNew (Th_BenchLifeExit, NULL, &attr);
+        if (id == NULL) {
+          break;
+        }
+        stat = osThreadJoin (id);
+        t1   = BENCH_TIME();
+        if ((stat != osOK) || (Bench_Run == 0U)) {
+          break;
+        }
+        Bench_Sample (t1 - Bench_T1);
+      }
+      ASSERT_TRUE (i == BENCH_SAMPLE_CNT);
+      Bench_Report ("osThreadExit to osThreadJoin return, %s", mem);
+    }
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchObjectNewDelete
+\details
+- Create and delete threads, timers, event flags, mutexes, semaphores, memory pools and message queues
+- Use kernel allocated memory and the user provided control block, stack and data buffers from RV2_Common.c
+- Report the cost of the os*New and os*Delete calls (osThreadTerminate for a thread that did not run)
+*/
+void TC_BenchObjectNewDelete (void) {
+#if (TC_BENCHOBJECTNEWDELETE_EN)
+  osStatus_t stat;
+  uint32_t type, user, i, k, ok, t0, t1, t2, t3;
+  const char *mem;
+
+  for (type = 0U; type < BENCH_OBJ_NUM; type++) {
+    for (user = 0U; user < 2U; user++) {
+      mem = (user != 0U) ? "user memory" : "kernel memory";
+      Bench_ObjAttr (user);
+      Bench_Start();
+
+      for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+        t0   = BENCH_TIME();
+        ok   = Bench_ObjNew ((BENCH_OBJ)type);
+        t1   = BENCH_TIME();
+        if (ok == 0U) {
+          break;
+        }
+        t2   = BENCH_TIME();
+        stat = Bench_ObjDelete ((BENCH_OBJ)type);
+        t3   = BENCH_TIME();
+        if (stat != osOK) {
+          break;
+        }
+        Bench_Sample (t1 - t0);
+        Bench_Del[i] = t3 - t2;
+      }
+      ASSERT_TRUE (i == BENCH_SAMPLE_CNT);
+
+      Bench_Report ("%s, %s", Bench_ObjName[type][0], mem);
+      for (k = 0U; k < i; k++) {
+        Bench_Sample (Bench_Del[k]);
+      }
+      Bench_Report ("%s, %s", Bench_ObjName[type][1], mem);
+    }
+  }
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * Thread: record first run (arg != NULL) and exit
+ *----------------------------------------------------------------------------*/
+void Th_BenchLifeExit (void *arg) {
+  uint32_t t = BENCH_TIME();
+
+  if (arg != NULL) {
+    Bench_Sample (t - Bench_T0);
+  }
+  Bench_Run = 1U;
+  Bench_T1  = BENCH_TIME();
+  osThreadExit();
+}
+
+/*-----------------------------------------------------------------------------
+ * Thread: terminated before it runs
+ *----------------------------------------------------------------------------*/
+void Th_BenchLifeIdle (void *arg) {
+  (void)arg;
+}
+
+/*-----------------------------------------------------------------------------
+ * Timer callback: not started
+ *----------------------------------------------------------------------------*/
+void Tim_BenchObject (void *arg) {
+  (void)arg;
+}
+
+/*-----------------------------------------------------------------------------
+ * Thread attributes with kernel (user = 0) or user provided memory
+ *----------------------------------------------------------------------------*/
+void Bench_ThreadAttr (osThreadAttr_t *attr, uint32_t user, uint32_t join, osPriority_t prio) {
+  const osThreadAttr_t def = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityNormal, 0U, 0U};
+
+  *attr = def;
+  attr->attr_bits = (join != 0U) ? osThreadJoinable : osThreadDetached;
+  attr->priority  = prio;
+  if (user != 0U) {
+    attr->cb_mem     = &Thread_CbMem;
+    attr->cb_size    = sizeof(Thread_CbMem);
+    attr->stack_mem  = &Thread_StackMem;
+    attr->stack_size = sizeof(Thread_StackMem);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Set object attributes for kernel (user = 0) or user provided memory
+ *----------------------------------------------------------------------------*/
+void Bench_ObjAttr (uint32_t user) {
+  Bench_ThreadAttr (&Bench_ThAttr, user, 0U, osPriorityBelowNormal);
+
+  Bench_TimAttr.cb_mem  = (user != 0U) ? &Timer_CbMem         : NULL;
+  Bench_TimAttr.cb_size = (user != 0U) ? sizeof(Timer_CbMem)  : 0U;
+
+  Bench_EfAttr.cb_mem   = (user != 0U) ? &EventFlags_CbMem        : NULL;
+  Bench_EfAttr.cb_size  = (user != 0U) ? sizeof(EventFlags_CbMem) : 0U;
+
+  Bench_MutAttr.cb_mem  = (user != 0U) ? &Mutex_CbMem         : NULL;
+  Bench_MutAttr.cb_size = (user != 0U) ? sizeof(Mutex_CbMem)  : 0U;
+
+  Bench_SemAttr.cb_mem  = (user != 0U) ? &Semaphore_CbMem        : NULL;
+  Bench_SemAttr.cb_size = (user != 0U) ? sizeof(Semaphore_CbMem) : 0U;
+
+  Bench_MpAttr.cb_mem   = (user != 0U) ? &MemoryPool_CbMem          : NULL;
+  Bench_MpAttr.cb_size  = (user != 0U) ? sizeof(MemoryPool_CbMem)   : 0U;
+  Bench_MpAttr.mp_mem   = (user != 0U) ? &MemoryPool_DataMem        : NULL;
+  Bench_MpAttr.mp_size  = (user != 0U) ? sizeof(MemoryPool_DataMem) : 0U;
+
+  Bench_MqAttr.cb_mem   = (user != 0U) ? &MessageQueue_CbMem          : NULL;
+  Bench_MqAttr.cb_size  = (user != 0U) ? sizeof(MessageQueue_CbMem)   : 0U;
+  Bench_MqAttr.mq_mem   = (user != 0U) ? &MessageQueue_DataMem        : NULL;
+  Bench_MqAttr.mq_size  = (user != 0U) ? sizeof(MessageQueue_DataMem) : 0U;
+}
+
+/*-----------------------------------------------------------------------------
+ * Create object with the attributes set by Bench_ObjAttr, returns 1 on success
+ *----------------------------------------------------------------------------*/
+uint32_t Bench_ObjNew (BENCH_OBJ type) {
+  switch (type) {
+    case BENCH_OBJ_THREAD:     Bench_Obj = osThreadNew       (Th_BenchLifeIdle, NULL, &Bench_ThAttr);              break;
+    case BENCH_OBJ_TIMER:      Bench_Obj = osTimerNew        (Tim_BenchObject, osTimerOnce, NULL, &Bench_TimAttr); break;
+    case BENCH_OBJ_EVENTFLAGS: Bench_Obj = osEventFlagsNew   (&Bench_EfAttr);                                      break;
+    case BENCH_OBJ_MUTEX:      Bench_Obj = osMutexNew        (&Bench_MutAttr);                                     break;
+    case BENCH_OBJ_SEMAPHORE:  Bench_Obj = osSemaphoreNew    (1U, 1U, &Bench_SemAttr);                             break;
+    case BENCH_OBJ_MEMORYPOOL: Bench_Obj = osMemoryPoolNew   (1U, 4U, &Bench_MpAttr);                              break;
+    default:                   Bench_Obj = osMessageQueueNew (1U, 4U, &Bench_MqAttr);                              break;
+  }
+  return ((Bench_Obj != NULL) ? 1U : 0U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Delete object created by Bench_ObjNew
+ *----------------------------------------------------------------------------*/
+osStatus_t Bench_ObjDelete (BENCH_OBJ type) {
+  osStatus_t stat;
+
+  switch (type) {
+    case BENCH_OBJ_THREAD:     stat = osThreadTerminate    ((osThreadId_t)      Bench_Obj); break;
+    case BENCH_OBJ_TIMER:      stat = osTimerDelete        ((osTimerId_t)       Bench_Obj); break;
+    case BENCH_OBJ_EVENTFLAGS: stat = osEventFlagsDelete   ((osEventFlagsId_t)  Bench_Obj); break;
+    case BENCH_OBJ_MUTEX:      stat = osMutexDelete        ((osMutexId_t)       Bench_Obj); break;
+    case BENCH_OBJ_SEMAPHORE:  stat = osSemaphoreDelete    ((osSemaphoreId_t)   Bench_Obj); break;
+    case BENCH_OBJ_MEMORYPOOL: stat = osMemoryPoolDelete   ((osMemoryPoolId_t)  Bench_Obj); break;
+    default:                   stat = osMessageQueueDelete ((osMessageQueueId_t)Bench_Obj); break;
+  }
+  return (stat);
+}
+#endif
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_ROUNDROBIN
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_OWNER_NONE    0xFFFFFFFFU /* No thread started a time slice */
+#define BENCH_ROBIN_ROUNDS  4U          /* Time slices per thread         */
+
+#if (TC_BENCH_EN)
+static osThreadId_t      Bench_MainId;  /* Thread running the test case   */
+static volatile uint32_t Bench_Stop;    /* Threads exit                   */
+static volatile uint32_t Bench_Owner;   /* Thread owning the time slice   */
+static uint32_t          Bench_SliceT;  /* Timestamp of the slice start   */
+static uint32_t          Bench_Iter[BENCH_THREAD_CNT];
+
+void Th_BenchRoundRobin (void *arg);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchRoundRobin
+\details
+- Run 1 to BENCH_THREAD_CNT compute bound threads at osPriorityBelowNormal for BENCH_INTERVAL milliseconds, extended
+  to 4 time slices per thread (time slice length measured with fewer threads)
+- Each thread counts loop iterations and records the start of its time slices
+- Report for more than one thread:
+  - time slice length statistics, from one thread switch to the next one
+  - fairness as the ratio of the largest to the smallest iteration count
+  - iterations lost against a single thread running for the same time without time slicing
+*/
+void TC_BenchRoundRobin (void) {
+#if (TC_BENCHROUNDROBIN_EN)
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityBelowNormal, 0U, 0U};
+  osThreadId_t id;
+  uint32_t n, i, tick, interval, ticks, slice_ticks, wait, flags, slice, min, max, lost;
+  uint64_t total, base;
+
+  Bench_MainId = osThreadGetId();
+  tick  = TS_GetTimestampFreq() / osKernelGetTickFreq();
+  interval = (BENCH_INTERVAL * osKernelGetTickFreq()) / 1000U;
+  if (interval == 0U) {
+    interval = 1U;
+  }
+  slice_ticks = 0U;
+  base = 0U;
+
+  for (n = 1U; n <= BENCH_THREAD_CNT; n++) {
+    /* Every thread gets several time slices, at least BENCH_INTERVAL */
+    ticks = slice_ticks * n * BENCH_ROBIN_ROUNDS;
+    if (ticks < interval) {
+      ticks = interval;
+    }
+    Bench_Stop  = 0U;
+    Bench_Owner = BENCH_OWNER_NONE;
+    osThreadFlagsClear ((1UL << BENCH_THREAD_CNT) - 1U);
+    Bench_Start();
+
+    /* Threads start when the test case thread blocks */
+    wait = 0U;
+    for (i = 0U; i < n; i++) {
+      Bench_Iter[i] = 0U;
+      id = osThreadNew (Th_BenchRoundRobin, &Bench_Iter[i], &attr);
+      ASSERT_TRUE (id != NULL);
+      if (id != NULL) {
+        wait |= 1UL << i;
+      }
+    }
+
+    osDelay (ticks);
+    Bench_Stop = 1U;
+
+    flags = osThreadFlagsWait (wait, osFlagsWaitAll, 100U);
+    ASSERT_TRUE (((int32_t)flags >= 0) && ((flags & wait) == wait));
+    if (wait != ((1UL << n) - 1U)) {
+      break;
+    }
+
+    total = 0U;
+    min   = UINT32_MAX;
+    max   = 0U;
+    for (i = 0U; i < n; i++) {
+      total += Bench_Iter[i];
+      if (Bench_Iter[i] < min) { min = Bench_Iter[i]; }
+      if (Bench_Iter[i] > max) { max = Bench_Iter[i]; }
+    }
+
+    if (n == 1U) {
+      /* Reference throughput without time slicing */
+      base = total;
+      Bench_Value ((uint32_t)(total / ticks), "iterations", "1 thread, per tick");
+      continue;
+    }
+
+    slice = Bench_Report ("%d threads, time slice", n);
+    Bench_Value ((slice + (tick / 2U)) / tick, "ticks", "%d threads, average time slice", n);
+    if (((slice + tick - 1U) / tick) > slice_ticks) {
+      slice_ticks = (slice + tick - 1U) / tick;
+    }
+    if (min != 0U) {
+      Bench_Value ((uint32_t)(((uint64_t)max * 100U) / min), "%", "%d threads, largest vs smallest share", n);
+    } else {
+      Bench_Value (min, "iterations", "%d threads, starved thread", n);
+    }
+    if (base != 0U) {
+      lost = (base > total) ? (uint32_t)(((base - total) * 1000000U) / base) : 0U;
+      Bench_Value (lost, "ppm", "%d threads, throughput lost vs 1 thread", n);
+    }
+  }
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * Compute bound thread: count iterations and record time slice switches
+ *----------------------------------------------------------------------------*/
+void Th_BenchRoundRobin (void *arg) {
+  uint32_t idx = (uint32_t)((uint32_t *)arg - Bench_Iter);
+  uint32_t cnt, t;
+  int32_t  lock;
+
+  cnt = 0U;
+  while (Bench_Stop == 0U) {
+    if (Bench_Owner != idx) {
+      /* Switched in: the previous slice ends, sampling is not preempted */
+      lock = osKernelLock();
+      t = BENCH_TIME();
+      if (Bench_Owner != BENCH_OWNER_NONE) {
+        Bench_Sample (t - Bench_SliceT);
+      }
+      Bench_SliceT = t;
+      Bench_Owner  = idx;
+      osKernelRestoreLock (lock);
+    }
+    cnt++;
+  }
+
+  Bench_Iter[idx] = cnt;
+  osThreadFlagsSet (Bench_MainId, 1UL << idx);
+}
+#endif
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_SCHEDULER
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_FLAG_GO       0x0001U     /* Wake the measured thread       */
+
+/* Priority levels of load threads: blocked threads use all levels from osPriorityLow
+   to osPriorityRealtime7, ready threads the levels below the test case thread */
+#define BENCH_PRIO_BLOCKED  ((uint32_t)osPriorityRealtime7 - (uint32_t)osPriorityLow + 1U)
+#define BENCH_PRIO_READY    ((uint32_t)osPriorityNormal    - (uint32_t)osPriorityLow)
+
+#if (TC_BENCH_EN)
+static osThreadId_t      Bench_HighId;  /* Measured high priority thread  */
+static volatile uint32_t Bench_T0;      /* Timestamp before the wake-up   */
+static volatile uint32_t Bench_T1;      /* Timestamp before blocking      */
+static osThreadId_t      Bench_LoadId[BENCH_SCHED_THREAD_CNT];
+static uint32_t          Bench_Back  [BENCH_SAMPLE_CNT];
+
+void Th_BenchSchedHigh    (void *arg);
+void Th_BenchSchedBlocked (void *arg);
+void Th_BenchSchedReady   (void *arg);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchSchedScaling
+\details
+- Add load threads until 1, 2, 4, ... up to BENCH_SCHED_THREAD_CNT threads exist:
+  - every second thread blocks in osThreadFlagsWait, spread over osPriorityLow to osPriorityRealtime7
+    (created at osPriorityRealtime7 so that it blocks before its priority is lowered)
+  - the other threads are ready, spread over osPriorityLow to osPriorityBelowNormal7
+- For each number of load threads measure:
+  - the time from osThreadFlagsSet until the woken osPriorityHigh thread runs
+  - the time from osThreadFlagsWait in the osPriorityHigh thread until the test case thread continues
+- Report the latency with the most load threads relative to a single load thread (100% for O(1) scheduling)
+*/
+void TC_BenchSchedScaling (void) {
+#if (TC_BENCHSCHEDSCALING_EN)
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityHigh, 0U, 0U};
+  uint32_t n, cnt, i, t, wake, back, wake_1, back_1;
+  osPriority_t prio;
+
+  Bench_HighId = osThreadNew (Th_BenchSchedHigh, NULL, &attr);
+  ASSERT_TRUE (Bench_HighId != NULL);
+  if (Bench_HighId == NULL) {
+    return;
+  }
+
+  wake   = 0U;
+  back   = 0U;
+  wake_1 = 0U;
+  back_1 = 0U;
+  cnt    = 0U;
+  n      = 1U;
+  for (;;) {
+    /* Add load threads, blocked threads preempt the test case thread and run until they block */
+    for (; cnt < n; cnt++) {
+      if ((cnt & 1U) == 0U) {
+        attr.priority = osPriorityRealtime7;
+        Bench_LoadId[cnt] = osThreadNew (Th_BenchSchedBlocked, NULL, &attr);
+        if (Bench_LoadId[cnt] != NULL) {
+          ASSERT_TRUE (osThreadGetState (Bench_LoadId[cnt]) == osThreadBlocked);
+          prio = (osPriority_t)((uint32_t)osPriorityLow + ((cnt / 2U) % BENCH_PRIO_BLOCKED));
+          ASSERT_TRUE (osThreadSetPriority (Bench_LoadId[cnt], prio) == osOK);
+        }
+      } else {
+        attr.priority = (osPriority_t)((uint32_t)osPriorityLow + ((cnt / 2U) % BENCH_PRIO_READY));
+        Bench_LoadId[cnt] = osThreadNew (Th_BenchSchedReady, NULL, &attr);
+      }
+      ASSERT_TRUE (Bench_LoadId[cnt] != NULL);
+      if (Bench_LoadId[cnt] == NULL) {
+        break;
+      }
+    }
+    if (cnt != n) {
+      break;
+    }
+
+    Bench_Start();
+    for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+      Bench_T0 = BENCH_TIME();
+      osThreadFlagsSet (Bench_HighId, BENCH_FLAG_GO);
+      t = BENCH_TIME();
+      Bench_Back[i] = t - Bench_T1;
+    }
+    ASSERT_TRUE (Bench_Count() == BENCH_SAMPLE_CNT);
+
+    wake = Bench_Report ("wake high priority thread, %d load threads", n);
+    for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+      Bench_Sample (Bench_Back[i]);
+    }
+    back = Bench_Report ("block high priority thread, %d load threads", n);
+    if (n == 1U) {
+      wake_1 = wake;
+      back_1 = back;
+    }
+
+    /* Double the load threads, last step uses BENCH_SCHED_THREAD_CNT threads */
+    if (n >= BENCH_SCHED_THREAD_CNT) {
+      break;
+    }
+    n = ((2U * n) < BENCH_SCHED_THREAD_CNT) ? (2U * n) : BENCH_SCHED_THREAD_CNT;
+  }
+
+  if ((n > 1U) && (wake_1 != 0U)) {
+    Bench_Value ((wake * 100U) / wake_1, "%", "wake %d vs 1 load threads", n);
+  }
+  if ((n > 1U) && (back_1 != 0U)) {
+    Bench_Value ((back * 100U) / back_1, "%", "block %d vs 1 load threads", n);
+  }
+
+  for (i = 0U; i < cnt; i++) {
+    ASSERT_TRUE (osThreadTerminate (Bench_LoadId[i]) == osOK);
+  }
+  ASSERT_TRUE (osThreadTerminate (Bench_HighId) == osOK);
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * Measured thread: record the wake-up latency and block again
+ *----------------------------------------------------------------------------*/
+void Th_BenchSchedHigh (void *arg) {
+  uint32_t t;
+  (void)arg;
+
+  for (;;) {
+    Bench_T1 = BENCH_TIME();
+    osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, osWaitForever);
+    t = BENCH_TIME();
+    Bench_Sample (t - Bench_T0);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Blocked load thread
+ *----------------------------------------------------------------------------*/
+void Th_BenchSchedBlocked (void *arg) {
+  (void)arg;
+
+  for (;;) {
+    osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, osWaitForever);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Ready load thread: runs only when higher priority threads are blocked
+ *----------------------------------------------------------------------------*/
+void Th_BenchSchedReady (void *arg) {
+  (void)arg;
+
+  for (;;) {
+    osThreadYield();
+  }
+}
+#endif
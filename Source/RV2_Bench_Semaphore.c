@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_SEMAPHORE
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_SEM_WAIT    5U            /* Acquire timeout to observe stop request [ticks] */
+
+/* Producer or consumer thread state */
+typedef struct {
+  volatile uint32_t ops;                /* Transferred tokens             */
+  volatile uint32_t fin;                /* Thread completed               */
+} BENCH_SEM_THREAD;
+
+/* Priority layout of producer and consumer threads */
+typedef struct {
+  const char  *name;
+  osPriority_t prod;
+  osPriority_t cons;
+} BENCH_SEM_LAYOUT;
+
+#if (TC_BENCH_EN)
+static const BENCH_SEM_LAYOUT Bench_Layout[] = {
+  { "equal priority",     osPriorityBelowNormal,  osPriorityBelowNormal  },
+  { "producers higher",   osPriorityBelowNormal4, osPriorityBelowNormal  },
+  { "consumers higher",   osPriorityBelowNormal,  osPriorityBelowNormal4 }
+};
+
+static osSemaphoreId_t   Bench_Items;   /* Produced tokens                */
+static osSemaphoreId_t   Bench_Space;   /* Free token slots               */
+static volatile uint32_t Bench_Stop;    /* Stop request                   */
+static BENCH_SEM_THREAD  Bench_Th[2U * BENCH_THREAD_CNT];
+#endif
+
+void Th_BenchSemProducer (void *arg);
+void Th_BenchSemConsumer (void *arg);
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchSemaphoreThroughput
+\details
+- Create a token semaphore and a slot semaphore with MAX_SEMAPHORE_TOKEN_CNT tokens
+- Run 1 to BENCH_THREAD_CNT producer and as many consumer threads for BENCH_INTERVAL milliseconds:
+  - producers acquire a slot and release a token
+  - consumers acquire a token and release a slot
+- Repeat for equal priorities, producers above consumers and consumers above producers
+- Report the transferred tokens per second and the cost of one semaphore call in timestamp cycles
+*/
+void TC_BenchSemaphoreThroughput (void) {
+#if (TC_BENCHSEMAPHORETHROUGHPUT_EN)
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityBelowNormal, 0U, 0U};
+  osThreadId_t id;
+  uint32_t l, n, i, t0, t1, tokens, cnt, fin, wait;
+
+  Bench_Items = osSemaphoreNew (MAX_SEMAPHORE_TOKEN_CNT, 0U, NULL);
+  ASSERT_TRUE (Bench_Items != NULL);
+  Bench_Space = osSemaphoreNew (MAX_SEMAPHORE_TOKEN_CNT, MAX_SEMAPHORE_TOKEN_CNT, NULL);
+  ASSERT_TRUE (Bench_Space != NULL);
+
+  if ((Bench_Items != NULL) && (Bench_Space != NULL)) {
+    for (l = 0U; l < (sizeof(Bench_Layout) / sizeof(Bench_Layout[0])); l++) {
+      for (n = 1U; n <= BENCH_THREAD_CNT; n++) {
+        Bench_Stop = 0U;
+
+        /* Threads start when the test case thread is delayed */
+        for (i = 0U; i < (2U * n); i++) {
+          Bench_Th[i].ops = 0U;
+          Bench_Th[i].fin = 0U;
+          if (i < n) {
+            attr.priority = Bench_Layout[l].prod;
+            id = osThreadNew (Th_BenchSemProducer, &Bench_Th[i], &attr);
+          } else {
+            attr.priority = Bench_Layout[l].cons;
+            id = osThreadNew (Th_BenchSemConsumer, &Bench_Th[i], &attr);
+          }
+          ASSERT_TRUE (id != NULL);
+          if (id == NULL) {
+            Bench_Th[i].fin = 1U;
+          }
+        }
+
+        t0 = BENCH_TIME();
+        osDelay ((BENCH_INTERVAL * osKernelGetTickFreq()) / 1000U);
+        Bench_Stop = 1U;
+        t1 = BENCH_TIME();
+
+        /* Wait until all threads observed the stop request */
+        for (wait = 0U; wait < 100U; wait++) {
+          fin = 0U;
+          for (i = 0U; i < (2U * n); i++) {
+            fin += Bench_Th[i].fin;
+          }
+          if (fin == (2U * n)) {
+            break;
+          }
+          osDelay (1U);
+        }
+        ASSERT_TRUE (wait < 100U);
+
+        tokens = 0U;
+        for (i = n; i < (2U * n); i++) {
+          tokens += Bench_Th[i].ops;
+        }
+        ASSERT_TRUE (tokens != 0U);
+
+        if ((tokens != 0U) && (t1 != t0)) {
+          Bench_Value ((uint32_t)(((uint64_t)tokens * TS_GetTimestampFreq()) / (t1 - t0)), "tokens/s",
+                       "throughput %d+%d threads, %s", n, n, Bench_Layout[l].name);
+          /* Each token is one acquire and one release on both semaphores */
+          Bench_Value ((t1 - t0) / (4U * tokens), "cycles/call",
+                       "call cost %d+%d threads, %s", n, n, Bench_Layout[l].name);
+        }
+
+        /* Return all tokens into the slot semaphore */
+        while (osSemaphoreAcquire (Bench_Items, 0U) == osOK) {
+          osSemaphoreRelease (Bench_Space);
+        }
+        cnt = osSemaphoreGetCount (Bench_Space);
+        ASSERT_TRUE (cnt == MAX_SEMAPHORE_TOKEN_CNT);
+        if (cnt != MAX_SEMAPHORE_TOKEN_CNT) {
+          break;
+        }
+      }
+    }
+  }
+
+  if (Bench_Items != NULL) {
+    ASSERT_TRUE (osSemaphoreDelete (Bench_Items) == osOK);
+  }
+  if (Bench_Space != NULL) {
+    ASSERT_TRUE (osSemaphoreDelete (Bench_Space) == osOK);
+  }
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCHSEMAPHORETHROUGHPUT_EN)
+/*-----------------------------------------------------------------------------
+ * Producer: acquire a free slot and release a token
+ *----------------------------------------------------------------------------*/
+void Th_BenchSemProducer (void *arg) {
+  BENCH_SEM_THREAD *th = (BENCH_SEM_THREAD *)arg;
+
+  while (Bench_Stop == 0U) {
+    if (osSemaphoreAcquire (Bench_Space, BENCH_SEM_WAIT) == osOK) {
+      osSemaphoreRelease (Bench_Items);
+      th->ops++;
+    }
+  }
+  th->fin = 1U;
+}
+
+/*-----------------------------------------------------------------------------
+ * Consumer: acquire a token and release a slot
+ *----------------------------------------------------------------------------*/
+void Th_BenchSemConsumer (void *arg) {
+  BENCH_SEM_THREAD *th = (BENCH_SEM_THREAD *)arg;
+
+  while (Bench_Stop == 0U) {
+    if (osSemaphoreAcquire (Bench_Items, BENCH_SEM_WAIT) == osOK) {
+      osSemaphoreRelease (Bench_Space);
+      th->ops++;
+    }
+  }
+  th->fin = 1U;
+}
+#endif
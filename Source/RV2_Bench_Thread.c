@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_THREAD
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_FLAG_PING   0x0001U       /* Ping-pong request              */
+#define BENCH_FLAG_PONG   0x0002U       /* Ping-pong response             */
+#define BENCH_FLAG_DONE   0x0004U       /* Benchmark thread completed     */
+
+static osThreadId_t      Bench_MainId;  /* Thread running the test case   */
+static volatile uint32_t Bench_T0;      /* Timestamp before the switch    */
+static volatile uint32_t Bench_Valid;   /* Bench_T0 was set by the peer   */
+
+void Th_BenchYield    (void *arg);
+void Th_BenchPreempt  (void *arg);
+void Th_BenchPingPong (void *arg);
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\defgroup bench_funcs Benchmarks
+\brief Benchmark Test Cases
+\details
+The benchmark test cases measure the latency of RTOS services and report the statistics (number of samples, minimum,
+average, maximum and 50th/90th/99th percentile) in timestamp cycles and nanoseconds. Benchmarks are enabled with
+\b TC_BENCH_EN in \c RV2_Config.h and use \b TS_GetTimestamp as time base. The number of samples per measurement is set
+with \b BENCH_SAMPLE_CNT.
+
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchThreadYield
+\details
+- Create two threads with equal priority which yield to each other
+- Measure the time from calling osThreadYield in one thread until the other thread runs
+*/
+void TC_BenchThreadYield (void) {
+#if (TC_BENCHTHREADYIELD_EN)
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityBelowNormal, 0U, 0U};
+  uint32_t flags;
+
+  Bench_MainId = osThreadGetId();
+  Bench_Valid  = 0U;
+  Bench_Start();
+
+  osThreadFlagsClear (BENCH_FLAG_DONE);
+  ASSERT_TRUE (osThreadNew (Th_BenchYield, NULL, &attr) != NULL);
+  ASSERT_TRUE (osThreadNew (Th_BenchYield, NULL, &attr) != NULL);
+
+  /* Both threads signal completion */
+  flags = osThreadFlagsWait (BENCH_FLAG_DONE, osFlagsWaitAny, osWaitForever);
+  ASSERT_TRUE (flags == BENCH_FLAG_DONE);
+  flags = osThreadFlagsWait (BENCH_FLAG_DONE, osFlagsWaitAny, osWaitForever);
+  ASSERT_TRUE (flags == BENCH_FLAG_DONE);
+
+  ASSERT_TRUE (Bench_Count() != 0U);
+  Bench_Report ("osThreadYield switch");
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchThreadPreempt
+\details
+- Create a higher priority thread waiting for a thread flag
+- Measure the time from calling osThreadFlagsSet until the waiting thread runs
+*/
+void TC_BenchThreadPreempt (void) {
+#if (TC_BENCHTHREADPREEMPT_EN)
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityAboveNormal, 0U, 0U};
+  osThreadId_t id;
+  uint32_t i;
+
+  Bench_MainId = osThreadGetId();
+  Bench_Start();
+
+  osThreadFlagsClear (BENCH_FLAG_DONE);
+  id = osThreadNew (Th_BenchPreempt, NULL, &attr);
+  ASSERT_TRUE (id != NULL);
+
+  if (id != NULL) {
+    for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+      Bench_T0 = BENCH_TIME();
+      osThreadFlagsSet (id, BENCH_FLAG_PING);
+    }
+    ASSERT_TRUE (osThreadFlagsWait (BENCH_FLAG_DONE, osFlagsWaitAny, osWaitForever) == BENCH_FLAG_DONE);
+  }
+
+  ASSERT_TRUE (Bench_Count() == BENCH_SAMPLE_CNT);
+  Bench_Report ("osThreadFlagsSet preemption");
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchThreadPingPong
+\details
+- Create a thread with equal priority which answers each thread flag with a thread flag
+- Measure the round trip time (two context switches through blocking waits)
+*/
+void TC_BenchThreadPingPong (void) {
+#if (TC_BENCHTHREADPINGPONG_EN)
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityNormal, 0U, 0U};
+  osThreadId_t id;
+  uint32_t i, t0, flags;
+
+  Bench_MainId = osThreadGetId();
+  Bench_Start();
+
+  osThreadFlagsClear (BENCH_FLAG_PONG | BENCH_FLAG_DONE);
+  id = osThreadNew (Th_BenchPingPong, NULL, &attr);
+  ASSERT_TRUE (id != NULL);
+
+  if (id != NULL) {
+    /* First round trip includes the thread start and is not measured */
+    for (i = 0U; i <= BENCH_SAMPLE_CNT; i++) {
+      t0 = BENCH_TIME();
+      osThreadFlagsSet (id, BENCH_FLAG_PING);
+      flags = osThreadFlagsWait (BENCH_FLAG_PONG, osFlagsWaitAny, osWaitForever);
+      if (i != 0U) {
+        Bench_Sample (BENCH_TIME() - t0);
+      }
+      if (flags != BENCH_FLAG_PONG) {
+        break;
+      }
+    }
+    ASSERT_TRUE (osThreadFlagsWait (BENCH_FLAG_DONE, osFlagsWaitAny, osWaitForever) == BENCH_FLAG_DONE);
+  }
+
+  ASSERT_TRUE (Bench_Count() == BENCH_SAMPLE_CNT);
+  Bench_Report ("osThreadFlags ping-pong round trip");
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * TC_BenchThreadYield: yield to the peer thread, measure switch from the peer
+ *----------------------------------------------------------------------------*/
+#if (TC_BENCHTHREADYIELD_EN)
+void Th_BenchYield (void *arg) {
+  uint32_t i, t;
+  (void)arg;
+
+  for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+    t = BENCH_TIME();
+    if (Bench_Valid != 0U) {
+      Bench_Sample (t - Bench_T0);
+    }
+    Bench_Valid = 1U;
+    Bench_T0    = BENCH_TIME();
+    osThreadYield();
+  }
+  /* The peer resumes without a preceding yield */
+  Bench_Valid = 0U;
+
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_DONE);
+}
+#endif
+
+/*-----------------------------------------------------------------------------
+ * TC_BenchThreadPreempt: measure wake-up from osThreadFlagsSet
+ *----------------------------------------------------------------------------*/
+#if (TC_BENCHTHREADPREEMPT_EN)
+void Th_BenchPreempt (void *arg) {
+  uint32_t i;
+  (void)arg;
+
+  for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+    if (osThreadFlagsWait (BENCH_FLAG_PING, osFlagsWaitAny, osWaitForever) != BENCH_FLAG_PING) {
+      break;
+    }
+    Bench_Sample (BENCH_TIME() - Bench_T0);
+  }
+
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_DONE);
+}
+#endif
+
+/*-----------------------------------------------------------------------------
+ * TC_BenchThreadPingPong: answer each ping with a pong
+ *----------------------------------------------------------------------------*/
+#if (TC_BENCHTHREADPINGPONG_EN)
+void Th_BenchPingPong (void *arg) {
+  uint32_t i;
+  (void)arg;
+
+  for (i = 0U; i <= BENCH_SAMPLE_CNT; i++) {
+    if (osThreadFlagsWait (BENCH_FLAG_PING, osFlagsWaitAny, osWaitForever) != BENCH_FLAG_PING) {
+      break;
+    }
+    osThreadFlagsSet (Bench_MainId, BENCH_FLAG_PONG);
+  }
+
+  osThreadFlagsSet (Bench_MainId, BENCH_FLAG_DONE);
+}
+#endif
+
+/**
+@}
+*/
+// end of group bench_funcs
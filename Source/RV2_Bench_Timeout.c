@@ -0,0 +1,362 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_TIMEOUT
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_FLAG_GO       0x0001U     /* Release the waiting thread     */
+#define BENCH_TIMEOUT_LONG  1000U       /* Timeouts not expiring during a measurement [ticks] */
+#define BENCH_TICK_SAMPLES  16U         /* Tick interrupts sampled per step */
+#define BENCH_WAKE_OFS      2U          /* First wake-up after the reference tick [ticks] */
+
+/* Measured timeout relative to the pending timeouts */
+typedef enum {
+  BENCH_TIMEOUT_NONE,                   /* osWaitForever                  */
+  BENCH_TIMEOUT_FIRST,                  /* Shorter than all pending       */
+  BENCH_TIMEOUT_LAST,                   /* Longer than all pending        */
+  BENCH_TIMEOUT_NUM
+} BENCH_TIMEOUT;
+
+#if (TC_BENCH_EN)
+static const char * const Bench_TimeoutName[BENCH_TIMEOUT_NUM] = {
+  "no timeout",
+  "shortest timeout",
+  "longest timeout"
+};
+
+static osThreadId_t      Bench_MainId;  /* Thread running the test case   */
+static volatile uint32_t Bench_T0;      /* Timestamp before blocking      */
+static uint32_t          Bench_Tick;    /* Tick period [timestamp cycles] */
+static uint32_t          Bench_TickRef; /* Reference tick of the wake-ups */
+static uint32_t          Bench_TimeRef; /* Timestamp of the reference tick */
+static uint32_t          Bench_Idx   [BENCH_TIMEOUT_CNT];
+static osThreadId_t      Bench_WaitId[BENCH_TIMEOUT_CNT];
+static osTimerId_t       Bench_TimId [BENCH_TIMEOUT_CNT];
+static uint32_t          Bench_Gap   [BENCH_TICK_SAMPLES];
+
+void     Th_BenchTimeoutWait  (void *arg);
+void     Th_BenchTimeoutProbe (void *arg);
+void     Tim_BenchTimeout     (void *arg);
+uint32_t Bench_TimeoutValue   (BENCH_TIMEOUT tmo, uint32_t n);
+void     Bench_TimeoutWake    (uint32_t idx);
+void     Bench_TimeoutTick    (uint32_t n, const char *ctx);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchTimeoutThread
+\details
+- Block 1, 2, 4, ... up to BENCH_TIMEOUT_CNT threads in osThreadFlagsWait with distinct timeouts
+- For each number of blocked threads measure:
+  - the time from a timed osThreadFlagsWait until a lower priority thread runs, with no timeout
+    and with a timeout inserted before and after all pending timeouts
+  - the tick interrupt duration, sampled around the tick boundary with the loop overhead removed
+  - the wake-up error of the threads released by osDelayUntil on distinct ticks
+- Report the wait with the longest timeout for the most threads relative to a single thread
+*/
+void TC_BenchTimeoutThread (void) {
+#if (TC_BENCHTIMEOUTTHREAD_EN)
+  osThreadAttr_t attr = { NULL, osThreadDetached, NULL, 0U, NULL, 0U, osPriorityAboveNormal, 0U, 0U};
+  osThreadId_t probe;
+  uint32_t n, cnt, i, tmo, last, last_1;
+
+  Bench_MainId = osThreadGetId();
+  Bench_Tick   = TS_GetTimestampFreq() / osKernelGetTickFreq();
+  osThreadFlagsClear (BENCH_FLAG_GO);
+
+  last   = 0U;
+  last_1 = 0U;
+  n      = 1U;
+  for (;;) {
+    /* Threads block with distinct timeouts in ascending order */
+    attr.priority = osPriorityAboveNormal;
+    for (cnt = 0U; cnt < n; cnt++) {
+      Bench_Idx[cnt]    = cnt;
+      Bench_WaitId[cnt] = osThreadNew (Th_BenchTimeoutWait, &Bench_Idx[cnt], &attr);
+      ASSERT_TRUE (Bench_WaitId[cnt] != NULL);
+      if (Bench_WaitId[cnt] == NULL) {
+        break;
+      }
+    }
+    if (cnt != n) {
+      for (i = 0U; i < cnt; i++) {
+        osThreadTerminate (Bench_WaitId[i]);
+      }
+      break;
+    }
+
+    /* Probe thread runs as soon as the test case thread blocks */
+    attr.priority = osPriorityBelowNormal;
+    probe = osThreadNew (Th_BenchTimeoutProbe, NULL, &attr);
+    ASSERT_TRUE (probe != NULL);
+    if (probe != NULL) {
+      for (tmo = BENCH_TIMEOUT_NONE; tmo < BENCH_TIMEOUT_NUM; tmo++) {
+        Bench_Start();
+        for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+          Bench_T0 = BENCH_TIME();
+          osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, Bench_TimeoutValue ((BENCH_TIMEOUT)tmo, n));
+        }
+        ASSERT_TRUE (Bench_Count() == BENCH_SAMPLE_CNT);
+        last = Bench_Report ("%d timed waits, osThreadFlagsWait with %s", n, Bench_TimeoutName[tmo]);
+      }
+      ASSERT_TRUE (osThreadTerminate (probe) == osOK);
+    }
+    if (n == 1U) {
+      last_1 = last;
+    }
+
+    Bench_TimeoutTick (n, "timed waits");
+
+    /* Release the threads within one tick, each one wakes on its own tick */
+    osDelay (1U);
+    Bench_TickRef = osKernelGetTickCount();
+    Bench_TimeRef = BENCH_TIME();
+    Bench_Start();
+    for (i = 0U; i < n; i++) {
+      osThreadFlagsSet (Bench_WaitId[i], BENCH_FLAG_GO);
+    }
+    osDelayUntil (Bench_TickRef + BENCH_WAKE_OFS + n + 1U);
+    ASSERT_TRUE (Bench_Count() == n);
+    Bench_Report ("%d timed waits, osDelayUntil wake-up error", n);
+
+    /* Double the threads, last step uses BENCH_TIMEOUT_CNT threads */
+    if (n >= BENCH_TIMEOUT_CNT) {
+      break;
+    }
+    n = ((2U * n) < BENCH_TIMEOUT_CNT) ? (2U * n) : BENCH_TIMEOUT_CNT;
+  }
+
+  if ((n > 1U) && (last_1 != 0U)) {
+    Bench_Value ((last * 100U) / last_1, "%", "%s, %d vs 1 timed waits",
+                 Bench_TimeoutName[BENCH_TIMEOUT_LAST], n);
+  }
+#endif
+}
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchTimeoutTimer
+\details
+- Run 1, 2, 4, ... up to BENCH_TIMEOUT_CNT one-shot timers with distinct timeouts
+- For each number of running timers measure:
+  - osTimerStart of an additional timer with a timeout before and after all pending timeouts
+  - the tick interrupt duration, sampled around the tick boundary with the loop overhead removed
+  - the expiration error of the timers restarted to expire on distinct ticks
+- Report osTimerStart with the longest timeout for the most timers relative to a single timer
+*/
+void TC_BenchTimeoutTimer (void) {
+#if (TC_BENCHTIMEOUTTIMER_EN)
+  osTimerId_t probe;
+  uint32_t n, cnt, i, tmo, t0, t1, last, last_1;
+
+  Bench_Tick = TS_GetTimestampFreq() / osKernelGetTickFreq();
+
+  probe = osTimerNew (Tim_BenchTimeout, osTimerOnce, NULL, NULL);
+  ASSERT_TRUE (probe != NULL);
+  if (probe == NULL) {
+    return;
+  }
+
+  last   = 0U;
+  last_1 = 0U;
+  n      = 1U;
+  for (;;) {
+    /* Timers run with distinct timeouts in ascending order */
+    for (cnt = 0U; cnt < n; cnt++) {
+      Bench_Idx[cnt]   = cnt;
+      Bench_TimId[cnt] = osTimerNew (Tim_BenchTimeout, osTimerOnce, &Bench_Idx[cnt], NULL);
+      ASSERT_TRUE (Bench_TimId[cnt] != NULL);
+      if (Bench_TimId[cnt] == NULL) {
+        break;
+      }
+      ASSERT_TRUE (osTimerStart (Bench_TimId[cnt], BENCH_TIMEOUT_LONG + cnt) == osOK);
+    }
+
+    if (cnt == n) {
+      for (tmo = BENCH_TIMEOUT_FIRST; tmo < BENCH_TIMEOUT_NUM; tmo++) {
+        Bench_Start();
+        for (i = 0U; i < BENCH_SAMPLE_CNT; i++) {
+          t0 = BENCH_TIME();
+          osTimerStart (probe, Bench_TimeoutValue ((BENCH_TIMEOUT)tmo, n));
+          t1 = BENCH_TIME();
+          Bench_Sample (t1 - t0);
+        }
+        last = Bench_Report ("%d timers, osTimerStart with %s", n, Bench_TimeoutName[tmo]);
+      }
+      ASSERT_TRUE (osTimerStop (probe) == osOK);
+      if (n == 1U) {
+        last_1 = last;
+      }
+
+      Bench_TimeoutTick (n, "timers");
+
+      /* Restart the timers within one tick, each one expires on its own tick */
+      for (i = 0U; i < n; i++) {
+        ASSERT_TRUE (osTimerStop (Bench_TimId[i]) == osOK);
+      }
+      osDelay (1U);
+      Bench_TickRef = osKernelGetTickCount();
+      Bench_TimeRef = BENCH_TIME();
+      Bench_Start();
+      for (i = 0U; i < n; i++) {
+        osTimerStart (Bench_TimId[i], BENCH_WAKE_OFS + i);
+      }
+      osDelayUntil (Bench_TickRef + BENCH_WAKE_OFS + n + 1U);
+      ASSERT_TRUE (Bench_Count() == n);
+      Bench_Report ("%d timers, expiration error", n);
+    }
+
+    for (i = 0U; i < cnt; i++) {
+      ASSERT_TRUE (osTimerDelete (Bench_TimId[i]) == osOK);
+    }
+
+    /* Double the timers, last step uses BENCH_TIMEOUT_CNT timers */
+    if ((cnt != n) || (n >= BENCH_TIMEOUT_CNT)) {
+      break;
+    }
+    n = ((2U * n) < BENCH_TIMEOUT_CNT) ? (2U * n) : BENCH_TIMEOUT_CNT;
+  }
+
+  if ((n > 1U) && (last_1 != 0U)) {
+    Bench_Value ((last * 100U) / last_1, "%", "%s, %d vs 1 timers",
+                 Bench_TimeoutName[BENCH_TIMEOUT_LAST], n);
+  }
+
+  ASSERT_TRUE (osTimerDelete (probe) == osOK);
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * Waiting thread: block with a distinct timeout, then wake on a distinct tick
+ *----------------------------------------------------------------------------*/
+void Th_BenchTimeoutWait (void *arg) {
+  uint32_t idx = *(uint32_t *)arg;
+
+  while (osThreadFlagsWait (BENCH_FLAG_GO, osFlagsWaitAny, BENCH_TIMEOUT_LONG + idx) == osFlagsErrorTimeout);
+
+  if (osDelayUntil (Bench_TickRef + BENCH_WAKE_OFS + idx) == osOK) {
+    Bench_TimeoutWake (idx);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Probe thread: record the blocking time and release the test case thread
+ *----------------------------------------------------------------------------*/
+void Th_BenchTimeoutProbe (void *arg) {
+  uint32_t t;
+  (void)arg;
+
+  for (;;) {
+    t = BENCH_TIME();
+    Bench_Sample (t - Bench_T0);
+    osThreadFlagsSet (Bench_MainId, BENCH_FLAG_GO);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Timer callback: record the expiration error (probe timer has no argument)
+ *----------------------------------------------------------------------------*/
+void Tim_BenchTimeout (void *arg) {
+  if (arg != NULL) {
+    Bench_TimeoutWake (*(uint32_t *)arg);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Timeout value relative to n pending timeouts
+ *----------------------------------------------------------------------------*/
+uint32_t Bench_TimeoutValue (BENCH_TIMEOUT tmo, uint32_t n) {
+  uint32_t ticks;
+
+  switch (tmo) {
+    case BENCH_TIMEOUT_NONE:
+      ticks = osWaitForever;
+      break;
+    case BENCH_TIMEOUT_FIRST:
+      ticks = BENCH_TIMEOUT_LONG / 2U;
+      break;
+    default:
+      ticks = BENCH_TIMEOUT_LONG + n;
+      break;
+  }
+  return (ticks);
+}
+
+/*-----------------------------------------------------------------------------
+ * Record the absolute error of a wake-up due on tick BENCH_WAKE_OFS + idx
+ *----------------------------------------------------------------------------*/
+void Bench_TimeoutWake (uint32_t idx) {
+  uint32_t t;
+  int32_t  err;
+
+  t   = BENCH_TIME();
+  err = (int32_t)(t - (Bench_TimeRef + ((BENCH_WAKE_OFS + idx) * Bench_Tick)));
+  Bench_Sample ((err < 0) ? (uint32_t)-err : (uint32_t)err);
+}
+
+/*-----------------------------------------------------------------------------
+ * Sample the tick interrupt duration from the timestamp gaps around the tick
+ *----------------------------------------------------------------------------*/
+void Bench_TimeoutTick (uint32_t n, const char *ctx) {
+  uint32_t i, tick, tk, t, t_prev, gap, gap_prev, cal;
+
+  /* Interrupt between the two reads extends the gap of the previous iteration */
+  cal      = UINT32_MAX;
+  gap_prev = 0U;
+  i        = 0U;
+  tick     = osKernelGetTickCount();
+  t_prev   = BENCH_TIME();
+  while (i < BENCH_TICK_SAMPLES) {
+    tk  = osKernelGetTickCount();
+    t   = BENCH_TIME();
+    gap = t - t_prev;
+    if (tk != tick) {
+      Bench_Gap[i++] = (gap > gap_prev) ? gap : gap_prev;
+      tick = tk;
+    } else if (gap < cal) {
+      cal = gap;
+    }
+    gap_prev = gap;
+    t_prev   = t;
+  }
+
+  Bench_Start();
+  for (i = 0U; i < BENCH_TICK_SAMPLES; i++) {
+    Bench_Sample ((Bench_Gap[i] > cal) ? (Bench_Gap[i] - cal) : 0U);
+  }
+  Bench_Report ("%d %s, tick interrupt", n, ctx);
+}
+#endif
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2023 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define TF_FILE_ID  RV2_FILE_BENCH_TIMER
+#include "RV2_Bench.h"
+
+/*-----------------------------------------------------------------------------
+ *      Test implementation
+ *----------------------------------------------------------------------------*/
+#define BENCH_HIST_BINS   10U           /* Jitter histogram bins          */
+#define BENCH_HIST_DIV    4U            /* Histogram bins per tick        */
+
+/* Periodic timer state */
+typedef struct {
+  osTimerId_t       id;
+  uint32_t          ticks;              /* Timer period [ticks]            */
+  uint32_t          period;             /* Timer period [timestamp cycles] */
+  volatile uint32_t cnt;                /* Callbacks after the first one   */
+  uint32_t          t_ref;              /* First callback timestamp        */
+  uint32_t          t_prev;             /* Previous callback timestamp     */
+  uint32_t          drift;              /* Maximum absolute drift          */
+  uint32_t          missed;             /* Missed periods                  */
+} BENCH_TIMER;
+
+#if (TC_BENCH_EN)
+/* Timer periods in ticks, assigned round robin */
+static const uint32_t Bench_Period[] = { 1U, 2U, 3U, 5U };
+
+static volatile uint32_t Bench_Stop;    /* Callbacks stop recording       */
+static BENCH_TIMER Bench_Tim[BENCH_TIMER_CNT];
+static uint32_t    Bench_BinWidth;      /* Histogram bin width [timestamp cycles] */
+static uint32_t    Bench_Hist[BENCH_HIST_BINS];
+
+void Tim_BenchTimerPeriodic (void *arg);
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Test cases
+ *----------------------------------------------------------------------------*/
+
+/**
+\addtogroup bench_funcs
+@{
+*/
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+/**
+\brief Test case: TC_BenchTimerPeriodic
+\details
+- Run 1, 2, 4, ... up to BENCH_TIMER_CNT periodic timers with periods of 1, 2, 3 and 5 ticks concurrently
+- Record callback entry timestamps for BENCH_TIMER_TICKS ticks
+- Report per timer count:
+  - absolute jitter statistics of the callback interval against the timer period
+  - jitter histogram in quarter tick bins
+  - maximum cumulative drift against the first callback
+  - missed periods
+*/
+void TC_BenchTimerPeriodic (void) {
+#if (TC_BENCHTIMERPERIODIC_EN)
+  uint32_t n, i, cnt, tick, done, drift, missed;
+  int32_t  lo;
+
+  tick = TS_GetTimestampFreq() / osKernelGetTickFreq();
+  Bench_BinWidth = tick / BENCH_HIST_DIV;
+  if (Bench_BinWidth == 0U) {
+    Bench_BinWidth = 1U;
+  }
+
+  n = 1U;
+  for (;;) {
+    Bench_Start();
+    for (i = 0U; i < BENCH_HIST_BINS; i++) {
+      Bench_Hist[i] = 0U;
+    }
+
+    for (cnt = 0U; cnt < n; cnt++) {
+      Bench_Tim[cnt].ticks  = Bench_Period[cnt % (sizeof(Bench_Period) / sizeof(Bench_Period[0]))];
+      Bench_Tim[cnt].period = Bench_Tim[cnt].ticks * tick;
+      Bench_Tim[cnt].cnt    = 0U;
+      Bench_Tim[cnt].drift  = 0U;
+      Bench_Tim[cnt].missed = 0U;
+      Bench_Tim[cnt].id     = osTimerNew (Tim_BenchTimerPeriodic, osTimerPeriodic, &Bench_Tim[cnt], NULL);
+      ASSERT_TRUE (Bench_Tim[cnt].id != NULL);
+      if (Bench_Tim[cnt].id == NULL) {
+        break;
+      }
+    }
+
+    /* Start all timers within one tick */
+    Bench_Stop = 0U;
+    osDelay (1U);
+    for (i = 0U; i < cnt; i++) {
+      ASSERT_TRUE (osTimerStart (Bench_Tim[i].id, Bench_Tim[i].ticks) == osOK);
+    }
+    osDelay (BENCH_TIMER_TICKS);
+    Bench_Stop = 1U;
+
+    done   = 0U;
+    drift  = 0U;
+    missed = 0U;
+    for (i = 0U; i < cnt; i++) {
+      ASSERT_TRUE (osTimerStop   (Bench_Tim[i].id) == osOK);
+      ASSERT_TRUE (osTimerDelete (Bench_Tim[i].id) == osOK);
+      /* Timer recorded at least one period */
+      if (Bench_Tim[i].cnt > 1U) {
+        done++;
+      }
+      if (Bench_Tim[i].drift > drift) {
+        drift = Bench_Tim[i].drift;
+      }
+      missed += Bench_Tim[i].missed;
+    }
+
+    Bench_Report ("jitter %d timers", n);
+    for (i = 0U; i < BENCH_HIST_BINS; i++) {
+      if (Bench_Hist[i] != 0U) {
+        lo = ((int32_t)i - (int32_t)(BENCH_HIST_BINS / 2U)) * (int32_t)Bench_BinWidth;
+        if (i == 0U) {
+          Bench_Value (Bench_Hist[i], "periods", "jitter %d timers, below %d", n, lo + (int32_t)Bench_BinWidth);
+        } else if (i == (BENCH_HIST_BINS - 1U)) {
+          Bench_Value (Bench_Hist[i], "periods", "jitter %d timers, %d and above", n, lo);
+        } else {
+          Bench_Value (Bench_Hist[i], "periods", "jitter %d timers, %d to %d", n, lo, lo + (int32_t)Bench_BinWidth);
+        }
+      }
+    }
+    ASSERT_TRUE (done == n);
+    Bench_Value (drift,  "cycles",  "max drift %d timers", n);
+    Bench_Value (missed, "periods", "missed periods %d timers", n);
+
+    /* Double the timers, last step measures BENCH_TIMER_CNT timers */
+    if ((cnt != n) || (done != n) || (n >= BENCH_TIMER_CNT)) {
+      break;
+    }
+    n = ((2U * n) < BENCH_TIMER_CNT) ? (2U * n) : BENCH_TIMER_CNT;
+  }
+#endif
+}
+
+/**
+@}
+*/
+// end of group bench_funcs
+
+#if (TC_BENCH_EN)
+/*-----------------------------------------------------------------------------
+ * Timer callback: record interval jitter, drift and missed periods
+ *----------------------------------------------------------------------------*/
+void Tim_BenchTimerPeriodic (void *arg) {
+  BENCH_TIMER *tim = (BENCH_TIMER *)arg;
+  uint32_t t, k, drift;
+  int32_t  jitter, bin;
+
+  t = BENCH_TIME();
+
+  if (Bench_Stop != 0U) {
+    return;
+  }
+
+  if (tim->cnt == 0U) {
+    /* First callback is the reference for drift */
+    tim->t_ref = t;
+  } else {
+    jitter = (int32_t)((t - tim->t_prev) - tim->period);
+    Bench_Sample ((jitter < 0) ? (uint32_t)-jitter : (uint32_t)jitter);
+
+    /* Floor division into bins centered on the period */
+    bin = ((jitter >= 0) ? (jitter / (int32_t)Bench_BinWidth)
+                         : (((jitter + 1) / (int32_t)Bench_BinWidth) - 1)) + (int32_t)(BENCH_HIST_BINS / 2U);
+    if (bin < 0) {
+      bin = 0;
+    }
+    if (bin > (int32_t)(BENCH_HIST_BINS - 1U)) {
+      bin = (int32_t)(BENCH_HIST_BINS - 1U);
+    }
+    Bench_Hist[bin]++;
+
+    /* Interval spans more than one and a half periods */
+    k = ((t - tim->t_prev) + (tim->period / 2U)) / tim->period;
+    if (k > 1U) {
+      tim->missed += k - 1U;
+    }
+
+    /* Expected time counts elapsed periods, including the missed ones */
+    drift = t - (tim->t_ref + ((tim->cnt + tim->missed) * tim->period));
+    if ((int32_t)drift < 0) {
+      drift = (uint32_t)-(int32_t)drift;
+    }
+    if (drift > tim->drift) {
+      tim->drift = drift;
+    }
+  }
+
+  tim->t_prev = t;
+  tim->cnt++;
+}
+#endif
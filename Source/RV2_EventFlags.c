@@ -18,6 +18,8 @@
 
 #include <stdbool.h>
 #include <string.h>
+
+#define TF_FILE_ID  RV2_FILE_EVENTFLAGS
 #include "cmsis_rv2.h"
 
 /*-----------------------------------------------------------------------------
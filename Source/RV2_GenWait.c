@@ -16,6 +16,7 @@
  * limitations under the License.
  */
 
+#define TF_FILE_ID  RV2_FILE_GENWAIT
 #include "cmsis_rv2.h"
 
 /*-----------------------------------------------------------------------------
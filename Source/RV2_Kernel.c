@@ -16,6 +16,7 @@
  * limitations under the License.
  */
 
+#define TF_FILE_ID  RV2_FILE_KERNEL
 #include "cmsis_rv2.h"
 
 /*-----------------------------------------------------------------------------
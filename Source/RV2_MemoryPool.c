@@ -17,6 +17,8 @@
  */
 
 #include <string.h>
+
+#define TF_FILE_ID  RV2_FILE_MEMORYPOOL
 #include "cmsis_rv2.h"
 
 /*-----------------------------------------------------------------------------
@@ -361,7 +363,7 @@ void TC_osMemoryPoolFree_1 (void) {
 void Irq_osMemoryPoolFree_1 (void) {
   void *block;
 
-  block = (void *)(uint32_t)Isr_pv;
+  block = (void *)(uintptr_t)Isr_pv;
 
   switch (Isr_u32) {
     case 0:
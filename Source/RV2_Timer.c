@@ -17,6 +17,8 @@
  */
 
 #include <string.h>
+
+#define TF_FILE_ID  RV2_FILE_TIMER
 #include "cmsis_rv2.h"
 
 /*-----------------------------------------------------------------------------
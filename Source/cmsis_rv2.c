@@ -18,6 +18,35 @@
 
 #include "cmsis_rv2.h"
 
+/*
+  Read test case filter from the semihosting command line
+  0: Disabled
+  1: Enabled (requires a debugger or simulator with semihosting enabled)
+*/
+#ifndef TS_FILTER_SEMIHOSTING
+#define TS_FILTER_SEMIHOSTING   0
+#endif
+
+/*
+  Test case time budget in milliseconds
+  Each test case runs in a worker thread which is terminated when the test
+  case does not complete within the budget (0: run test cases in TestRunner)
+*/
+#ifndef TS_TC_TIMEOUT
+#define TS_TC_TIMEOUT           0
+#endif
+
+#define TS_TC_DONE_FLAG         (1UL << 30)
+
+/*
+  Maximum number of threads existing before a test case (framework and kernel threads)
+  Helper threads of a test case are identified (memory report, removal after
+  a timeout) only when less threads exist before the test case
+*/
+#ifndef TS_THREAD_MAX
+#define TS_THREAD_MAX           32
+#endif
+
 static const osThreadAttr_t tf_main_attr = {
   .name          = "TestRunner",
   .attr_bits     = osThreadDetached,
@@ -25,11 +54,59 @@ static const osThreadAttr_t tf_main_attr = {
   .cb_size       = 0U,
   .stack_mem     = NULL,
   .stack_size    = MAIN_THREAD_STACK,
+#if (TS_TC_TIMEOUT != 0)
+  .priority      = osPriorityRealtime7,
+#else
   .priority      = osPriorityNormal,
+#endif
   .tz_module     = 0,
   .affinity_mask = 0
 };
 
+#if (TS_TC_TIMEOUT != 0)
+static const osThreadAttr_t tc_worker_attr = {
+  .name          = "TestCase",
+  .attr_bits     = osThreadDetached,
+  .cb_mem        = NULL,
+  .cb_size       = 0U,
+  .stack_mem     = NULL,
+  .stack_size    = MAIN_THREAD_STACK,
+  .priority      = osPriorityNormal,
+  .tz_module     = 0,
+  .affinity_mask = 0
+};
+
+static void (*volatile tc_func)(void);
+static osThreadId_t    tc_runner;
+#endif
+
+/* Memory usage of the current test case */
+static MEM_STAT        tc_mem;
+static osThreadId_t    tc_worker_id;
+static osThreadId_t    tc_threads[TS_THREAD_MAX];
+static uint32_t        tc_threads_num;
+static osThreadId_t    tc_enum[TS_THREAD_MAX];
+
+#if (TF_OUTPUT_DEFERRED == 2)
+static const osThreadAttr_t tf_logger_attr = {
+  .name          = "TestLogger",
+  .attr_bits     = osThreadDetached,
+  .cb_mem        = NULL,
+  .cb_size       = 0U,
+  .stack_mem     = NULL,
+  .stack_size    = MAIN_THREAD_STACK,
+  .priority      = osPriorityLow,
+  .tz_module     = 0,
+  .affinity_mask = 0
+};
+
+#define TF_LOG_DATA             (1UL << 0)    /* Record published by producer  */
+#define TF_LOG_SPACE            (1UL << 1)    /* Records written by the logger */
+
+static osThreadId_t     tf_logger_id;
+static osEventFlagsId_t tf_logger_ev;
+#endif
+
 /*-----------------------------------------------------------------------------
  *      Init test suite
  *----------------------------------------------------------------------------*/
@@ -42,6 +119,74 @@ __WEAK void TS_Init (void) {
 __WEAK void TS_Uninit (void) {
 }
 
+/*-----------------------------------------------------------------------------
+ *      Get test case filter (override to provide a filter from other source)
+ *----------------------------------------------------------------------------*/
+__WEAK const char *TS_GetFilter (void) {
+#if (TS_FILTER_SEMIHOSTING != 0) && defined(__GNUC__) && defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+  static char cmd_line[256];
+  struct {
+    char    *buf;
+    uint32_t len;
+  } arg = { cmd_line, sizeof(cmd_line) };
+  register uint32_t r0 __ASM("r0") = 0x15U;   /* SYS_GET_CMDLINE */
+  register void    *r1 __ASM("r1") = &arg;
+
+  __ASM volatile ("bkpt 0xAB" : "+r" (r0) : "r" (r1) : "memory");
+
+  if (r0 != 0U) {
+    return (NULL);
+  }
+  return (cmd_line);
+#else
+  return (NULL);
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ *      Get test case timestamp (override for a higher resolution counter)
+ *----------------------------------------------------------------------------*/
+__WEAK uint32_t TS_GetTimestamp (void) {
+  return osKernelGetSysTimerCount();
+}
+
+/*-----------------------------------------------------------------------------
+ *      Get test case timestamp frequency in Hz
+ *----------------------------------------------------------------------------*/
+__WEAK uint32_t TS_GetTimestampFreq (void) {
+  return osKernelGetSysTimerFreq();
+}
+
+/*-----------------------------------------------------------------------------
+ *      Get kernel dynamic memory size in bytes (0: not available)
+ *----------------------------------------------------------------------------*/
+__WEAK uint32_t TS_GetHeapSize (void) {
+  return (0U);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Get kernel dynamic memory usage in bytes (0: not available)
+ *----------------------------------------------------------------------------*/
+__WEAK uint32_t TS_GetHeapUsage (void) {
+  return (0U);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Get kernel dynamic memory peak usage since the previous call in bytes
+ *      (default: RTOS does not track the peak, return the current usage)
+ *----------------------------------------------------------------------------*/
+__WEAK uint32_t TS_GetHeapPeak (void) {
+  return (TS_GetHeapUsage());
+}
+
+/*-----------------------------------------------------------------------------
+ *      Fill the unused stack of the running thread with the RTOS stack
+ *      watermark pattern (return 0: not available)
+ *----------------------------------------------------------------------------*/
+__WEAK uint32_t TS_StackPaint (void) {
+  return (0U);
+}
+
 /*-----------------------------------------------------------------------------
  *      Enable IRQ
  *----------------------------------------------------------------------------*/
@@ -63,6 +208,24 @@ __WEAK void SetPendingIRQ (int32_t irq_num) {
   (void)irq_num;
 }
 
+/*-----------------------------------------------------------------------------
+ *      Check if thread was created by the test case (helper thread)
+ *----------------------------------------------------------------------------*/
+static uint32_t tc_helper (osThreadId_t thread_id) {
+  uint32_t i;
+
+  if (thread_id == tc_worker_id) {
+    return (0U);
+  }
+  for (i = 0U; i < tc_threads_num; i++) {
+    if (thread_id == tc_threads[i]) {
+      /* Thread existed before the test case */
+      return (0U);
+    }
+  }
+  return (1U);
+}
+
 /*-----------------------------------------------------------------------------
  *      Test cases list
  *----------------------------------------------------------------------------*/
@@ -78,7 +241,8 @@ static const TEST_CASE TC_List[] = {
   TCD ( TC_osKernelUnlock_1,              TC_OSKERNELUNLOCK_1_EN              ),
   TCD ( TC_osKernelUnlock_2,              TC_OSKERNELUNLOCK_2_EN              ),
   TCD ( TC_osKernelRestoreLock_1,         TC_OSKERNELRESTORELOCK_1_EN         ),
-  TCD ( TC_osKernelSuspend_1,             TC_OSKERNELSUSPEND_1_EN             ),
+  /* Requires that no kernel timeout is pending */
+  TCDF( TC_osKernelSuspend_1,             TC_OSKERNELSUSPEND_1_EN,            TCF_NO_TIMEOUT),
   TCD ( TC_osKernelResume_1,              TC_OSKERNELRESUME_1_EN              ),
   TCD ( TC_osKernelGetTickCount_1,        TC_OSKERNELGETTICKCOUNT_EN          ),
   TCD ( TC_osKernelGetTickFreq_1,         TC_OSKERNELGETTICKFREQ_EN           ),
@@ -248,6 +412,277 @@ static const TEST_CASE TC_List[] = {
   TCD ( TC_MsgQWait,                      TC_MSGQWAIT_EN                      ),
   TCD ( TC_MsgQCheckTimeout,              TC_MSGQCHECKTIMEOUT_EN              ),
 #endif
+#if (TC_BENCH_EN)
+  TCD ( TC_BenchThreadYield,              TC_BENCHTHREADYIELD_EN              ),
+  TCD ( TC_BenchThreadPreempt,            TC_BENCHTHREADPREEMPT_EN            ),
+  TCD ( TC_BenchThreadPingPong,           TC_BENCHTHREADPINGPONG_EN           ),
+  TCD ( TC_BenchIsrThreadFlags,           TC_BENCHISRTHREADFLAGS_EN           ),
+  TCD ( TC_BenchIsrEventFlags,            TC_BENCHISREVENTFLAGS_EN            ),
+  TCD ( TC_BenchIsrSemaphore,             TC_BENCHISRSEMAPHORE_EN             ),
+  TCD ( TC_BenchIsrMessageQueue,          TC_BENCHISRMESSAGEQUEUE_EN          ),
+  TCD ( TC_BenchIsrMemoryPool,            TC_BENCHISRMEMORYPOOL_EN            ),
+  TCD ( TC_BenchMutexUncontended,         TC_BENCHMUTEXUNCONTENDED_EN         ),
+  TCD ( TC_BenchMutexRecursive,           TC_BENCHMUTEXRECURSIVE_EN           ),
+  TCD ( TC_BenchMutexHandoff,             TC_BENCHMUTEXHANDOFF_EN             ),
+  TCD ( TC_BenchMutexInheritChain,        TC_BENCHMUTEXINHERITCHAIN_EN        ),
+  TCD ( TC_BenchSemaphoreThroughput,      TC_BENCHSEMAPHORETHROUGHPUT_EN      ),
+  TCD ( TC_BenchMsgQLatency,              TC_BENCHMSGQLATENCY_EN              ),
+  TCD ( TC_BenchMsgQThread,               TC_BENCHMSGQTHREAD_EN               ),
+  TCD ( TC_BenchMsgQIsrToThread,          TC_BENCHMSGQISRTOTHREAD_EN          ),
+  TCD ( TC_BenchMsgQThreadToIsr,          TC_BENCHMSGQTHREADTOISR_EN          ),
+  TCD ( TC_BenchMemPoolThread,            TC_BENCHMEMPOOLTHREAD_EN            ),
+  TCD ( TC_BenchMemPoolIsr,               TC_BENCHMEMPOOLISR_EN               ),
+  TCD ( TC_BenchEvFlagsBroadcastAny,      TC_BENCHEVFLAGSBROADCASTANY_EN      ),
+  TCD ( TC_BenchEvFlagsBroadcastAll,      TC_BENCHEVFLAGSBROADCASTALL_EN      ),
+  TCD ( TC_BenchTimerPeriodic,            TC_BENCHTIMERPERIODIC_EN            ),
+  TCD ( TC_BenchDelayUntil,               TC_BENCHDELAYUNTIL_EN               ),
+  TCD ( TC_BenchDelayUntilLoad,           TC_BENCHDELAYUNTILLOAD_EN           ),
+  TCD ( TC_BenchThreadLifecycle,          TC_BENCHTHREADLIFECYCLE_EN          ),
+  TCD ( TC_BenchObjectNewDelete,          TC_BENCHOBJECTNEWDELETE_EN          ),
+  TCD ( TC_BenchKernelThread,             TC_BENCHKERNELTHREAD_EN             ),
+  TCD ( TC_BenchKernelIsr,                TC_BENCHKERNELISR_EN                ),
+  TCD ( TC_BenchSchedScaling,             TC_BENCHSCHEDSCALING_EN             ),
+  TCD ( TC_BenchTimeoutThread,            TC_BENCHTIMEOUTTHREAD_EN            ),
+  TCD ( TC_BenchTimeoutTimer,             TC_BENCHTIMEOUTTIMER_EN             ),
+  TCD ( TC_BenchRoundRobin,               TC_BENCHROUNDROBIN_EN               ),
+#endif
+};
+
+#if (TF_OUTPUT_DEFERRED == 2)
+/*-----------------------------------------------------------------------------
+ *      Test report logger: write deferred output when nothing else runs
+ *----------------------------------------------------------------------------*/
+static __NO_RETURN void tf_logger (void *arg) {
+  (void)arg;
+
+  for (;;) {
+    osEventFlagsWait(tf_logger_ev, TF_LOG_DATA, osFlagsWaitAny, osWaitForever);
+    while (TReport_Drain() != 0U) {}
+    osEventFlagsSet(tf_logger_ev, TF_LOG_SPACE);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ *      Deferred output record published: wake up the logger
+ *----------------------------------------------------------------------------*/
+void stdout_notify (void) {
+  osEventFlagsSet(tf_logger_ev, TF_LOG_DATA);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Wait until the logger wrote the published records
+ *      (the logger runs at the priority of the waiting thread meanwhile)
+ *----------------------------------------------------------------------------*/
+int stdout_wait (void) {
+  osPriority_t prio;
+  uint32_t flags;
+
+  if (osKernelGetState() != osKernelRunning) {
+    return (-1);
+  }
+  prio = osThreadGetPriority(osThreadGetId());
+  if (prio == osPriorityError) {
+    /* Interrupt context */
+    return (-1);
+  }
+
+  osEventFlagsClear(tf_logger_ev, TF_LOG_SPACE);
+  if (prio > tf_logger_attr.priority) {
+    osThreadSetPriority(tf_logger_id, prio);
+  }
+  osEventFlagsSet(tf_logger_ev, TF_LOG_DATA);
+  flags = osEventFlagsWait(tf_logger_ev, TF_LOG_SPACE, osFlagsWaitAny, osWaitForever);
+  if (prio > tf_logger_attr.priority) {
+    osThreadSetPriority(tf_logger_id, tf_logger_attr.priority);
+  }
+
+  return (((int32_t)flags < 0) ? -1 : 0);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Uninit test suite after the logger wrote all deferred output
+ *----------------------------------------------------------------------------*/
+static void tf_uninit (void) {
+  while (TReport_Pending() != 0U) {
+    if (stdout_wait() != 0) {
+      break;
+    }
+  }
+  TS_Uninit();
+}
+#endif
+
+#if (TS_TC_TIMEOUT != 0)
+/*-----------------------------------------------------------------------------
+ *      Test case worker: execute test function and notify the runner
+ *----------------------------------------------------------------------------*/
+static __NO_RETURN void tc_worker (void *arg) {
+  (void)arg;
+
+  tc_func();
+  osThreadFlagsSet(tc_runner, TS_TC_DONE_FLAG);
+
+  /* Wait to be terminated by the runner */
+  for (;;) {
+    osThreadSuspend(osThreadGetId());
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ *      Execute test function in a worker thread supervised by the runner
+ *      (return 1 on timeout)
+ *----------------------------------------------------------------------------*/
+static uint32_t tc_supervise (const TEST_CASE *tc) {
+  uint32_t flags, timeout;
+
+  if ((tc->flags & TCF_NO_TIMEOUT) != 0U) {
+    timeout = osWaitForever;
+  } else {
+    timeout = (uint32_t)(((uint64_t)TS_TC_TIMEOUT * osKernelGetTickFreq()) / 1000U);
+  }
+
+  tc_func   = tc->TestFunc;
+  tc_runner = osThreadGetId();
+  osThreadFlagsClear(TS_TC_DONE_FLAG);
+
+  tc_worker_id = osThreadNew(tc_worker, NULL, &tc_worker_attr);
+  if (tc_worker_id == NULL) {
+    /* No resources for the worker: run test case in the runner */
+    tc->TestFunc();
+    return (0U);
+  }
+
+  flags = osThreadFlagsWait(TS_TC_DONE_FLAG, osFlagsWaitAny, timeout);
+
+  return (((flags & osFlagsError) != 0U) ? 1U : 0U);
+}
+#endif
+
+/*-----------------------------------------------------------------------------
+ *      Terminate helper threads left behind by a hanging test case
+ *----------------------------------------------------------------------------*/
+static void tc_cleanup (void) {
+  uint32_t num, cnt, i;
+
+  if (tc_threads_num >= TS_THREAD_MAX) {
+    /* Threads existing before the test case are not known */
+    return;
+  }
+
+  /* Enumeration is limited to TS_THREAD_MAX threads: repeat until no helper is left */
+  do {
+    cnt = 0U;
+    num = osThreadEnumerate (tc_enum, TS_THREAD_MAX);
+    for (i = 0U; i < num; i++) {
+      if ((tc_helper (tc_enum[i]) != 0U) && (osThreadTerminate (tc_enum[i]) == osOK)) {
+        cnt++;
+      }
+    }
+  } while (cnt != 0U);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Execute test case and record its memory usage (return 1 on timeout)
+ *----------------------------------------------------------------------------*/
+static uint32_t tc_execute (const TEST_CASE *tc) {
+  osThreadId_t id;
+  uint32_t     tout, size, space, num, i;
+  uint32_t     paint, heap, peak;
+
+  /* Threads existing before the test case are not accounted to it */
+  tc_threads_num = osThreadEnumerate (tc_threads, TS_THREAD_MAX);
+  tc_mem.stack     = 0U;
+  tc_mem.tstack    = 0U;
+  tc_mem.heap      = 0U;
+  tc_mem.heap_size = TS_GetHeapSize();
+
+  /* Restart the runner stack watermark and the kernel memory peak */
+  paint = TS_StackPaint();
+  heap  = TS_GetHeapUsage();
+  (void)TS_GetHeapPeak();
+
+#if (TS_TC_TIMEOUT != 0)
+  tout = tc_supervise (tc);
+#else
+  tc->TestFunc();
+  tout = 0U;
+#endif
+
+  /* Stack usage of the thread which executed the test case (new worker or re-painted runner) */
+  id = (tc_worker_id != NULL) ? tc_worker_id : osThreadGetId();
+  if ((tc_worker_id != NULL) || (paint != 0U)) {
+    space = osThreadGetStackSpace (id);
+    if (space < MAIN_THREAD_STACK) {
+      tc_mem.stack = MAIN_THREAD_STACK - space;
+    }
+  }
+
+  /* Stack usage of helper threads still existing at the end of the test case */
+  if (tc_threads_num < TS_THREAD_MAX) {
+    num = osThreadEnumerate (tc_enum, TS_THREAD_MAX);
+    for (i = 0U; i < num; i++) {
+      if (tc_helper (tc_enum[i]) == 0U) {
+        continue;
+      }
+      size  = osThreadGetStackSize  (tc_enum[i]);
+      space = osThreadGetStackSpace (tc_enum[i]);
+      if ((size > space) && ((size - space) > tc_mem.tstack)) {
+        tc_mem.tstack = size - space;
+      }
+    }
+  }
+
+  /* Kernel memory peak above the usage before the test case */
+  peak = TS_GetHeapPeak();
+  if (peak > heap) {
+    tc_mem.heap = peak - heap;
+  }
+  TReport_TestMemory (&tc_mem);
+
+#if (TS_TC_TIMEOUT != 0)
+  if (tc_worker_id != NULL) {
+    /* Remove the worker before the next test case (completed or hanging) */
+    osThreadTerminate (tc_worker_id);
+    tc_worker_id = NULL;
+  }
+#endif
+
+  if (tout != 0U) {
+    /* Remove helper threads left behind by the hanging test case */
+    tc_cleanup();
+  }
+
+  return (tout);
+}
+
+/*-----------------------------------------------------------------------------
+ *      Test module file names (indexed by file identifier)
+ *----------------------------------------------------------------------------*/
+static const char * const TS_Files[RV2_FILE_NUM] = {
+  [RV2_FILE_KERNEL]       = "RV2_Kernel.c",
+  [RV2_FILE_THREAD]       = "RV2_Thread.c",
+  [RV2_FILE_THREADFLAGS]  = "RV2_ThreadFlags.c",
+  [RV2_FILE_GENWAIT]      = "RV2_GenWait.c",
+  [RV2_FILE_TIMER]        = "RV2_Timer.c",
+  [RV2_FILE_EVENTFLAGS]   = "RV2_EventFlags.c",
+  [RV2_FILE_MUTEX]        = "RV2_Mutex.c",
+  [RV2_FILE_SEMAPHORE]    = "RV2_Semaphore.c",
+  [RV2_FILE_MEMORYPOOL]   = "RV2_MemoryPool.c",
+  [RV2_FILE_MESSAGEQUEUE] = "RV2_MessageQueue.c",
+  [RV2_FILE_BENCH_THREAD] = "RV2_Bench_Thread.c",
+  [RV2_FILE_BENCH_ISR]    = "RV2_Bench_Isr.c",
+  [RV2_FILE_BENCH_MUTEX]  = "RV2_Bench_Mutex.c",
+  [RV2_FILE_BENCH_SEMAPHORE] = "RV2_Bench_Semaphore.c",
+  [RV2_FILE_BENCH_MESSAGEQUEUE] = "RV2_Bench_MessageQueue.c",
+  [RV2_FILE_BENCH_MEMORYPOOL] = "RV2_Bench_MemoryPool.c",
+  [RV2_FILE_BENCH_EVENTFLAGS] = "RV2_Bench_EventFlags.c",
+  [RV2_FILE_BENCH_TIMER]  = "RV2_Bench_Timer.c",
+  [RV2_FILE_BENCH_GENWAIT] = "RV2_Bench_GenWait.c",
+  [RV2_FILE_BENCH_OBJECT] = "RV2_Bench_Object.c",
+  [RV2_FILE_BENCH_KERNEL] = "RV2_Bench_Kernel.c",
+  [RV2_FILE_BENCH_SCHEDULER] = "RV2_Bench_Scheduler.c",
+  [RV2_FILE_BENCH_TIMEOUT] = "RV2_Bench_Timeout.c",
+  [RV2_FILE_BENCH_ROUNDROBIN] = "RV2_Bench_RoundRobin.c"
 };
 
 /*-----------------------------------------------------------------------------
@@ -257,10 +692,20 @@ static TEST_SUITE ts = {
   __FILE__, __DATE__, __TIME__,
   "CMSIS-RTOS2 Test Suite",
   TS_Init,
+#if (TF_OUTPUT_DEFERRED == 2)
+  tf_uninit,
+#else
   TS_Uninit,
+#endif
   1,
   TC_List,
-  sizeof(TC_List)/sizeof(TC_List[0])
+  sizeof(TC_List)/sizeof(TC_List[0]),
+  TS_GetTimestamp,
+  TS_GetTimestampFreq,
+  TS_GetFilter,
+  tc_execute,
+  TS_Files,
+  RV2_FILE_NUM
 };
 
 /*-----------------------------------------------------------------------------
@@ -274,6 +719,12 @@ int cmsis_rv2 (void) {
   /* Create test framework main function as a thread */
   osThreadNew((osThreadFunc_t)tf_main, &ts, &tf_main_attr);
 
+#if (TF_OUTPUT_DEFERRED == 2)
+  /* Create test report logger thread */
+  tf_logger_ev = osEventFlagsNew(NULL);
+  tf_logger_id = osThreadNew(tf_logger, NULL, &tf_logger_attr);
+#endif
+
   /* Start executing the test framework main function */
   osKernelStart();
 
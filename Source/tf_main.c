@@ -16,9 +16,217 @@
  * limitations under the License.
  */
 
+#include <string.h>
+
 #include "tf_main.h"
 #include "tf_report.h"
 
+/*-----------------------------------------------------------------------------
+ * Match test function name against glob pattern (* and ?) of given length
+ *----------------------------------------------------------------------------*/
+static uint32_t tf_match (const char *pat, uint32_t len, const char *str) {
+
+  while (len != 0U) {
+    if (*pat == '*') {
+      /* Try to match remaining pattern at every position */
+      do {
+        if (tf_match (pat + 1, len - 1U, str) != 0U) {
+          return (1U);
+        }
+      } while (*str++ != '\0');
+      return (0U);
+    }
+    if ((*str == '\0') || ((*pat != '?') && (*pat != *str))) {
+      return (0U);
+    }
+    pat++;
+    str++;
+    len--;
+  }
+  return ((*str == '\0') ? 1U : 0U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Parse decimal number, return number of digits
+ *----------------------------------------------------------------------------*/
+static uint32_t tf_number (const char *str, uint32_t len, uint32_t *val) {
+  uint32_t n;
+
+  *val = 0U;
+  for (n = 0U; (n < len) && (str[n] >= '0') && (str[n] <= '9'); n++) {
+    *val = (*val * 10U) + (uint32_t)(str[n] - '0');
+  }
+  return (n);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get next filter token, return token length (0: end of filter)
+ *----------------------------------------------------------------------------*/
+static uint32_t tf_token (const char **filter, const char **tok) {
+  const char *p = *filter;
+  uint32_t    len;
+
+  while ((*p == ' ') || (*p == '\t') || (*p == ',')) {
+    p++;
+  }
+  *tok = p;
+  for (len = 0U; (p[len] != '\0') && (p[len] != ' ') && (p[len] != '\t') && (p[len] != ','); len++);
+  *filter = p + len;
+
+  return (len);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get argument of filter option "--name value" or "--name=value",
+ * return argument length (0: option not present)
+ *----------------------------------------------------------------------------*/
+static uint32_t tf_option (const char *filter, const char *name, const char **arg) {
+  const char *tok;
+  uint32_t    len, n, ret;
+
+  n    = (uint32_t)strlen (name);
+  ret  = 0U;
+  *arg = "";
+
+  while ((len = tf_token (&filter, &tok)) != 0U) {
+    if ((len >= n) && (strncmp (tok, name, n) == 0)) {
+      if ((len > (n + 1U)) && (tok[n] == '=')) {
+        /* --name=value */
+        *arg = &tok[n + 1U];
+        ret  = len - n - 1U;
+      } else if (len == n) {
+        /* --name value */
+        ret = tf_token (&filter, arg);
+      } else {
+        /* Other option with the same prefix */
+      }
+    }
+  }
+  return (ret);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get test shard from filter option "--shard i/N" (i = 1..N)
+ *----------------------------------------------------------------------------*/
+static void tf_shard (const char *filter, uint32_t *shard, uint32_t *shards) {
+  const char *tok;
+  uint32_t    len, n, i, cnt;
+
+  *shard  = 0U;
+  *shards = 1U;
+
+  len = tf_option (filter, "--shard", &tok);
+  n   = tf_number (tok, len, &i);
+  if ((n != 0U) && (n < len) && (tok[n] == '/')) {
+    n += 1U;
+    if ((tf_number (&tok[n], len - n, &cnt) == (len - n)) && (i >= 1U) && (i <= cnt)) {
+      *shard  = i - 1U;
+      *shards = cnt;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Get test case repeat count and time from filter options
+ * "--repeat N" and "--repeat-time MS"
+ *----------------------------------------------------------------------------*/
+static void tf_repeat (const char *filter, uint32_t *count, uint32_t *time) {
+  const char *tok;
+  uint32_t    len, val;
+
+  *count = TF_REPEAT;
+  *time  = TF_REPEAT_TIME;
+
+  len = tf_option (filter, "--repeat", &tok);
+  if ((len != 0U) && (tf_number (tok, len, &val) == len) && (val != 0U)) {
+    *count = val;
+  }
+  len = tf_option (filter, "--repeat-time", &tok);
+  if ((len != 0U) && (tf_number (tok, len, &val) == len)) {
+    *time = val;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Execute test case once, return 1 on timeout
+ *----------------------------------------------------------------------------*/
+static uint32_t tf_execute (TEST_SUITE *ts, const TEST_CASE *tc) {
+
+  if (ts->Execute == NULL) {
+    tc->TestFunc();
+  }
+  else if (ts->Execute(tc) != 0U) {
+    TReport_TestTimeout ();               /* Test case did not complete       */
+    return (1U);
+  }
+  return (0U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Check if test case is selected by the filter
+ *
+ * Filter tokens (separated by spaces or commas):
+ *   TC_name*   include test cases with function name matching the glob pattern
+ *   N or N-M   include test cases with number N or numbers N to M
+ *   !token     exclude test cases matching the token
+ *   --shard i/N  select every N-th of the included test cases, starting with i-th
+ *                (also --shard=i/N)
+ *   --repeat N   execute each test case N times
+ *   --repeat-time MS  execute each test case repeatedly for MS milliseconds
+ * All test cases are included when the filter has no include tokens.
+ *----------------------------------------------------------------------------*/
+static uint32_t tf_select (const char *filter, uint32_t no, const char *fn) {
+  const char *tok;
+  uint32_t    len, n, lo, hi, incl, match, excl;
+
+  incl  = 0U;
+  match = 0U;
+  excl  = 0U;
+
+  while ((len = tf_token (&filter, &tok)) != 0U) {
+    if ((tok[0] == '-') && (len > 1U) && (tok[1] == '-')) {
+      /* Option: skip its argument unless given as --option=value */
+      if (memchr (tok, '=', len) == NULL) {
+        tf_token (&filter, &tok);
+      }
+      continue;
+    }
+    if (tok[0] == '!') {
+      excl = 1U;
+      tok++;
+      len--;
+    } else {
+      excl = 0U;
+      incl = 1U;
+    }
+
+    n = tf_number (tok, len, &lo);
+    if ((n != 0U) && (n == len)) {
+      /* Test number */
+      hi = lo;
+    } else if ((n != 0U) && (tok[n] == '-') && (tf_number (&tok[n+1U], len - n - 1U, &hi) == (len - n - 1U)) && (hi != 0U)) {
+      /* Test number range */
+    } else {
+      /* Function name glob pattern */
+      if ((len != 0U) && (tf_match (tok, len, fn) != 0U)) {
+        if (excl != 0U) {
+          return (0U);
+        }
+        match = 1U;
+      }
+      continue;
+    }
+    if ((no >= lo) && (no <= hi)) {
+      if (excl != 0U) {
+        return (0U);
+      }
+      match = 1U;
+    }
+  }
+
+  return (((incl == 0U) || (match != 0U)) ? 1U : 0U);
+}
+
 /*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
 /**
 \defgroup framework_funcs Test Framework Functions
@@ -33,12 +241,17 @@
 \details
 Program flow:
   -# Test suite Init() callback function is called if function is provided
+  -# Test case filter is read if function is provided
   -# Test report statistics is initialized
+  -# Test case timestamp counter is set if function is provided
+  -# Test module file names table is set
   -# Test report headers are written to the standard output
-  -# All defined test cases are executed:
+  -# All defined test cases selected by the filter are executed:
       - Test case statistics is initialized
       - Test case report header is written to the standard output
-      - Test case is executed
+      - Test case is executed (execution time is measured), using the
+        Execute() callback function if provided. The test case is repeated
+        for the configured count or time, until an iteration times out
       - Test case results are written to the standard output
       - Test case is closed
   -# Test report footer is written to the standard output
@@ -47,14 +260,36 @@ Program flow:
 */
 void tf_main (TEST_SUITE *ts) {
   const char *fn;
-  uint32_t tc, no;
+  const char *filter;
+  uint32_t tc, no, sel, shard, shards;
+  uint32_t repeat, rtime, run, tout, last, now;
+  uint64_t elapsed, limit;
 
   /* Init test suite */
   if (ts->Init != NULL) {
     ts->Init();
   }
 
+  /* Get test case filter */
+  filter = (ts->Filter != NULL) ? ts->Filter() : NULL;
+  if (filter == NULL) {
+    filter = "";
+  }
+  tf_shard  (filter, &shard, &shards);
+  tf_repeat (filter, &repeat, &rtime);
+  sel = 0U;
+
+  /* Repeat time requires the timestamp counter */
+  limit = 0U;
+  if ((rtime != 0U) && (ts->Timestamp != NULL) && (ts->TimestampFreq != NULL)) {
+    limit = ((uint64_t)rtime * ts->TimestampFreq()) / 1000U;
+  }
+
   TReport_Init ();                        /* Init test report                 */
+  TReport_SetTimestamp (ts->Timestamp,    /* Set test case timestamp counter  */
+                        (ts->TimestampFreq != NULL) ? ts->TimestampFreq() : 0U);
+  TReport_SetFiles (ts->Files,            /* Set test module file names       */
+                    ts->NumOfFiles);
   TReport_Open (ts->ReportTitle,          /* Write test report title          */
                 ts->Date,                 /* Write compilation date           */
                 ts->Time,                 /* Write compilation time           */
@@ -64,9 +299,28 @@ void tf_main (TEST_SUITE *ts) {
   for (tc = 0; tc < ts->NumOfTC; tc++) {
     no = ts->TCBaseNum+tc;                /* Test case number                 */
     fn = ts->TC[tc].TFName;               /* Test function name string        */
+    if (tf_select (filter, no, fn) == 0U) {
+      continue;                           /* Skip test case not in filter     */
+    }
+    if ((sel++ % shards) != shard) {
+      continue;                           /* Skip test case not in this shard */
+    }
     TReport_TestOpen (no, fn);            /* Open test case                   */
-    if (ts->TC[tc].en) 
-      ts->TC[tc].TestFunc();              /* Execute test case if enabled     */
+    if (ts->TC[tc].en) {                  /* Execute test case if enabled     */
+      elapsed = 0U;
+      last    = (limit != 0U) ? ts->Timestamp() : 0U;
+      run     = 0U;
+      do {
+        tout = tf_execute (ts, &ts->TC[tc]);
+        TReport_TestIteration ();         /* Update iteration statistics      */
+        run++;
+        if (limit != 0U) {
+          now      = ts->Timestamp();
+          elapsed += now - last;
+          last     = now;
+        }
+      } while ((tout == 0U) && ((limit != 0U) ? (elapsed < limit) : (run < repeat)));
+    }
     TReport_TestClose ();                 /* Close test case                  */
   }
   TReport_Close ();                       /* Close test report                */
@@ -20,14 +20,17 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "cmsis_compiler.h"
+
 #include "tf_main.h"
 #include "tf_report.h"
 #include "tf_assert.h"
 
 /*
   Select test report print output
-  0: Standard C library STDOUT
-  1: Private printf implementation calling extern function stdout_putchar(ch)
+  0: Standard C library formatting, buffered output written by stdout_write(buf, len)
+  1: Private printf implementation, buffered output written by stdout_write(buf, len)
+     (default stdout_write calls extern function stdout_putchar(ch))
 */
 #ifndef TF_OUTPUT
 #define TF_OUTPUT           1
@@ -42,6 +45,25 @@
 #define TF_OUTPUT_CRLF      1
 #endif
 
+/*
+  Output buffer size in bytes
+  Print output is collected in a buffer and written in bulk by stdout_write(buf, len)
+*/
+#ifndef TF_OUTPUT_BUF_SIZE
+#define TF_OUTPUT_BUF_SIZE  256
+#endif
+
+/*
+  Select output buffer flush granularity
+  0: Record: flush when buffer is full and at the end of each report record
+  1: Line:   flush when buffer is full and at the end of each line
+  Ignored with deferred output (TF_OUTPUT_DEFERRED != 0): records are always
+  published to the ring buffer as a whole
+*/
+#ifndef TF_OUTPUT_FLUSH
+#define TF_OUTPUT_FLUSH     0
+#endif
+
 /* Global Test Report structure */
 TEST_REPORT TestReport;
 
@@ -50,15 +72,31 @@ TEST_REPORT TestReport;
 #if (TF_OUTPUT == 0)
   /* Use standard C library functions */
   #define PRINT(x) print_stdio x
-  #define FLUSH()  flush_stdio()
+  #define FLUSH()  out_flush()
 #elif (TF_OUTPUT == 1)
   /* Use static printf implementation and out_putchar() */
   #define PRINT(x) printf_lim x
-  #define FLUSH()
+  #define FLUSH()  out_flush()
 #else
   #error "Unknown TF_OUTPUT setting."
 #endif
 
+#if (TF_OUTPUT_BUF_SIZE < 1)
+  #error "Invalid TF_OUTPUT_BUF_SIZE setting."
+#endif
+
+#if ((TF_OUTPUT_FLUSH != 0) && (TF_OUTPUT_FLUSH != 1))
+  #error "Invalid TF_OUTPUT_FLUSH setting."
+#endif
+
+#if ((TF_OUTPUT_DEFERRED < 0) || (TF_OUTPUT_DEFERRED > 2))
+  #error "Invalid TF_OUTPUT_DEFERRED setting."
+#endif
+
+#if ((TF_OUTPUT_RING_SIZE < 2) || ((TF_OUTPUT_RING_SIZE & (TF_OUTPUT_RING_SIZE - 1)) != 0))
+  #error "TF_OUTPUT_RING_SIZE must be a power of 2."
+#endif
+
 /* Select print statement EOL style */
 #if (TF_OUTPUT_CRLF == 0)
   /* End Of Line: \n */
@@ -76,30 +114,209 @@ static AS_STAT AssertStat;
 #define TC_Asserts (&AssertStat)            /* Assert statistics: for the current Test Case */
 #define TR_Asserts (&TestReport.assertions) /* Assert statistics: all Test Cases combined   */
 
+/* Test case timestamp counter */
+static uint32_t (*TS_Counter)(void);        /* Timestamp counter function (NULL: disabled)  */
+static uint32_t   TS_Freq;                  /* Timestamp counter frequency [Hz]             */
+static uint32_t   TS_Start;                 /* Timestamp at current Test Case start         */
+static uint32_t   TC_Cycles;                /* Current Test Case execution time [cycles]    */
+static uint32_t   TC_Num;                   /* Current Test Case number                     */
+static const char *TC_Name;                 /* Current Test Case function name              */
+static uint32_t   TC_Timeout;               /* Current Test Case did not complete in time   */
+static MEM_STAT   TC_Mem;                   /* Current Test Case memory usage               */
+static uint32_t   TC_MemValid;              /* Current Test Case memory usage was reported  */
+static uint32_t   TC_Lines;                 /* Current Test Case printed detail lines       */
+
+/* Test module file names (assertion file identifiers) */
+#define TF_FILE_NONE      0xFFFFU           /* Assertion location given as file name        */
+static const char * const *TF_Files;        /* File names indexed by file identifier        */
+static uint32_t   TF_NumFiles;              /* Number of file names                         */
+
+/* Test case repeat statistics */
+static RUN_STAT   TC_Run;                   /* Current Test Case iteration statistics       */
+static uint32_t   TS_Iter;                  /* Timestamp at current iteration start         */
+static uint32_t   TC_IterFailed;            /* Failed assertions before current iteration   */
+static uint32_t   TC_IterFirst;             /* First iteration time (deviation reference)   */
+static uint64_t   TC_IterSum;               /* Sum of iteration times                       */
+static int64_t    TC_IterSd;                /* Sum of deviations from the first iteration   */
+static uint64_t   TC_IterSdd;               /* Sum of squared deviations                    */
+
 static const char *Passed  = "PASSED";
 static const char *Warning = "WARNING";
 static const char *Failed  = "FAILED";
 static const char *NotExe  = "NOT EXECUTED";
+static const char *Timeout = "TIMEOUT";
+
+#if (TF_OUTPUT_DEFERRED == 0)
+/* Output buffer */
+static char     OutBuf[TF_OUTPUT_BUF_SIZE];
+static uint32_t OutCnt;
+#else
+/* Deferred output ring buffer (single producer, single consumer) */
+static char              RingBuf[TF_OUTPUT_RING_SIZE];
+static volatile uint32_t RingHead;          /* Published records end: written by producer */
+static volatile uint32_t RingTail;          /* Output position: written by consumer       */
+static uint32_t          RecHead;           /* Current record end (not yet published)     */
+static uint32_t          RecDrop;           /* Current record does not fit into the ring  */
+#endif
 
 /* Printer function prototypes */
+#if (TF_OUTPUT == 1)
+extern int stdout_putchar (int ch);
+#endif
+#if (PRINT_BINARY_REPORT == 0)
 #if (TF_OUTPUT == 0)
 static void print_stdio (const char *msg, ...);
-static void flush_stdio (void);
 #elif (TF_OUTPUT == 1)
-extern int stdout_putchar (int ch);
-static int out_putchar    (int ch);
 static int printf_lim (const char *fmt, ...);
 #endif
+#endif
+extern int stdout_write   (const char *buf, uint32_t len);
+#if (TF_OUTPUT_DEFERRED != 0)
+extern void stdout_notify (void);
+extern int  stdout_wait   (void);
+#endif
+static int out_putchar    (int ch);
+static void out_flush     (void);
 
 /* Test report function prototypes */
-static const char *tr_Eval (void);
 static const char *tc_Eval (void);
+#if (PRINT_BINARY_REPORT == 0)
+static const char *tr_Eval (void);
+static const char *tr_Time (uint64_t cycles, char *buf);
+static uint32_t    tr_Ns   (uint32_t cycles);
+#endif
+static uint32_t tr_Sqrt (uint64_t val);
+
+#if (PRINT_BINARY_REPORT == 1)
+/*
+  Binary report record framing (all values little-endian):
+    sync[2]  : 0xA5 0x5A
+    type     : record type
+    len      : payload length
+    payload  : len bytes
+    crc[2]   : CRC-16/CCITT-FALSE over type, len and payload
+*/
+#define BIN_SYNC_0          0xA5U
+#define BIN_SYNC_1          0x5AU
+#define BIN_VERSION         1U
+
+/* Binary report record types */
+#define BIN_REPORT_OPEN     0x01U   /* version, timestamp frequency, title                  */
+#define BIN_TC_DETAIL       0x02U   /* test number, result, file hash, line                 */
+#define BIN_TC_CLOSE        0x03U   /* test number, result, name hash, asserts, cycles      */
+#define BIN_REPORT_CLOSE    0x04U   /* test statistics, dropped records, total cycles       */
+#define BIN_TC_MEMORY       0x05U   /* test number, stack, helper stack, heap peak          */
+#define BIN_REPORT_MEMORY   0x06U   /* peak stack, helper stack, heap peak, heap size       */
+#define BIN_TC_REPEAT       0x07U   /* test number, iterations, failed, min/mean/max/dev    */
+#define BIN_FILE_NAME       0x08U   /* file identifier, file name                           */
+#define BIN_TC_DETAIL_LOC   0x09U   /* test number, result, file identifier, line           */
+#define BIN_TC_BENCH        0x0AU   /* test number, samples, min/avg/max/p50/p90/p99, name  */
+#define BIN_TC_VALUE        0x0BU   /* test number, value, name, unit                       */
+
+/* Binary report result codes */
+#define BIN_RES_PASSED      0U
+#define BIN_RES_WARNING     1U
+#define BIN_RES_FAILED      2U
+#define BIN_RES_NOT_EXE     3U
+#define BIN_RES_TIMEOUT     4U
+
+/*-----------------------------------------------------------------------------
+ * Binary report: update CRC-16/CCITT-FALSE with data
+ *----------------------------------------------------------------------------*/
+static uint16_t bin_crc16 (uint16_t crc, const uint8_t *data, uint32_t len) {
+  uint32_t i;
+
+  while (len != 0U) {
+    crc ^= (uint16_t)(*data++ << 8);
+    for (i = 0U; i < 8U; i++) {
+      if ((crc & 0x8000U) != 0U) {
+        crc = (uint16_t)((crc << 1) ^ 0x1021U);
+      } else {
+        crc = (uint16_t)(crc << 1);
+      }
+    }
+    len--;
+  }
+  return (crc);
+}
+
+/*-----------------------------------------------------------------------------
+ * Binary report: FNV-1a hash of a string (identifies names and files)
+ *----------------------------------------------------------------------------*/
+static uint32_t bin_hash (const char *str) {
+  uint32_t h = 2166136261U;
+
+  while (*str != '\0') {
+    h ^= (uint8_t)*str++;
+    h *= 16777619U;
+  }
+  return (h);
+}
+
+/*-----------------------------------------------------------------------------
+ * Binary report: store little-endian values, return number of bytes
+ *----------------------------------------------------------------------------*/
+static uint32_t bin_u16 (uint8_t *p, uint32_t val) {
+  p[0] = (uint8_t)(val);
+  p[1] = (uint8_t)(val >> 8);
+  return (2U);
+}
+
+static uint32_t bin_u32 (uint8_t *p, uint32_t val) {
+  p[0] = (uint8_t)(val);
+  p[1] = (uint8_t)(val >> 8);
+  p[2] = (uint8_t)(val >> 16);
+  p[3] = (uint8_t)(val >> 24);
+  return (4U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Binary report: convert result string to result code
+ *----------------------------------------------------------------------------*/
+static uint8_t bin_res (const char *res) {
+  if (res == Passed)  { return (BIN_RES_PASSED);  }
+  if (res == Warning) { return (BIN_RES_WARNING); }
+  if (res == Failed)  { return (BIN_RES_FAILED);  }
+  if (res == Timeout) { return (BIN_RES_TIMEOUT); }
+  return (BIN_RES_NOT_EXE);
+}
+
+/*-----------------------------------------------------------------------------
+ * Binary report: output framed record
+ *----------------------------------------------------------------------------*/
+static void bin_record (uint8_t type, const uint8_t *data, uint32_t len) {
+  uint8_t  hdr[4];
+  uint16_t crc;
+  uint32_t i;
+
+  hdr[0] = BIN_SYNC_0;
+  hdr[1] = BIN_SYNC_1;
+  hdr[2] = type;
+  hdr[3] = (uint8_t)len;
+
+  crc = bin_crc16 (0xFFFFU, &hdr[2], 2U);
+  crc = bin_crc16 (crc, data, len);
+
+  for (i = 0U; i < 4U; i++) {
+    out_putchar(hdr[i]);
+  }
+  for (i = 0U; i < len; i++) {
+    out_putchar(data[i]);
+  }
+  out_putchar((uint8_t)(crc));
+  out_putchar((uint8_t)(crc >> 8));
+}
+#endif /* PRINT_BINARY_REPORT */
 
 /*-----------------------------------------------------------------------------
  * Print Test Report: Start test case description
  *----------------------------------------------------------------------------*/
 static void TR_Print_Open_TC (uint32_t num, const char *fn) {
-#if (PRINT_XML_REPORT == 1)
+#if (PRINT_BINARY_REPORT == 1)
+  /* Test case is reported at close only */
+  (void)num;
+  (void)fn;
+#elif (PRINT_XML_REPORT == 1)
   PRINT(("<tc>%s", TF_EOL));
   PRINT(("<no>%d</no>%s",     num, TF_EOL));
   PRINT(("<func>%s</func>%s", fn,  TF_EOL));
@@ -113,8 +330,26 @@ static void TR_Print_Open_TC (uint32_t num, const char *fn) {
 /*-----------------------------------------------------------------------------
  * Print Test Report: Add test case debug information
  *----------------------------------------------------------------------------*/
-static void TR_Print_WriteDebug (const char *fn, uint32_t ln, char *desc, const char *res) {
-#if (PRINT_XML_REPORT == 1)
+static void TR_Print_WriteDebug (const char *fn, uint32_t id, uint32_t ln, char *desc, const char *res) {
+#if (PRINT_BINARY_REPORT == 1)
+  uint8_t rec[12];
+
+  (void)desc;
+  bin_u16 (&rec[0], TC_Num);
+  rec[2] = bin_res (res);
+  rec[3] = 0U;
+  if (id != TF_FILE_NONE) {
+    /* File name is listed in the report header */
+    bin_u16 (&rec[4], id);
+    bin_u16 (&rec[6], ln);
+    bin_record (BIN_TC_DETAIL_LOC, rec, 8U);
+  } else {
+    bin_u32 (&rec[4], bin_hash (fn));
+    bin_u32 (&rec[8], ln);
+    bin_record (BIN_TC_DETAIL, rec, sizeof(rec));
+  }
+#elif (PRINT_XML_REPORT == 1)
+  (void)id;
   PRINT(("<detail>%s", TF_EOL));
   PRINT(("<module>%s</module>%s", fn, TF_EOL));
   PRINT(("<line>%d</line>%s",     ln, TF_EOL));
@@ -126,6 +361,8 @@ static void TR_Print_WriteDebug (const char *fn, uint32_t ln, char *desc, const
   }
   PRINT(("</detail>%s", TF_EOL));
 #else
+  (void)id;
+  TC_Lines = 1U;
   PRINT(("%s  %s (%d)", TF_EOL, fn, ln));
   if (res != NULL) {
     PRINT((" [%s]", res));
@@ -136,19 +373,168 @@ static void TR_Print_WriteDebug (const char *fn, uint32_t ln, char *desc, const
 #endif
   FLUSH();
 }
+
+/*-----------------------------------------------------------------------------
+ * Print Test Report: Add test case benchmark statistics
+ *----------------------------------------------------------------------------*/
+static void TR_Print_Bench (const BENCH_STAT *st) {
+#if (PRINT_BINARY_REPORT == 1)
+  uint8_t     rec[255];
+  const char *name = st->name;
+  uint32_t    n;
+
+  bin_u16 (&rec[0],  TC_Num);
+  bin_u16 (&rec[2],  0U);
+  bin_u32 (&rec[4],  st->cnt);
+  bin_u32 (&rec[8],  st->min);
+  bin_u32 (&rec[12], st->avg);
+  bin_u32 (&rec[16], st->max);
+  bin_u32 (&rec[20], st->p50);
+  bin_u32 (&rec[24], st->p90);
+  bin_u32 (&rec[28], st->p99);
+  for (n = 32U; (n < sizeof(rec)) && (*name != '\0'); n++) {
+    rec[n] = (uint8_t)*name++;
+  }
+  bin_record (BIN_TC_BENCH, rec, n);
+#elif (PRINT_XML_REPORT == 1)
+  PRINT(("<bench>%s", TF_EOL));
+  PRINT(("<name>%s</name>%s", st->name, TF_EOL));
+  PRINT(("<cnt>%d</cnt>%s",   st->cnt,  TF_EOL));
+  PRINT(("<cyc><min>%d</min><avg>%d</avg><max>%d</max><p50>%d</p50><p90>%d</p90><p99>%d</p99></cyc>%s",
+         st->min, st->avg, st->max, st->p50, st->p90, st->p99, TF_EOL));
+  if (TS_Freq != 0U) {
+    PRINT(("<ns><min>%d</min><avg>%d</avg><max>%d</max><p50>%d</p50><p90>%d</p90><p99>%d</p99></ns>%s",
+           tr_Ns (st->min), tr_Ns (st->avg), tr_Ns (st->max),
+           tr_Ns (st->p50), tr_Ns (st->p90), tr_Ns (st->p99), TF_EOL));
+  }
+  PRINT(("</bench>%s", TF_EOL));
+#else
+  TC_Lines = 1U;
+  PRINT(("%s  %s: %d samples, min/avg/max %d/%d/%d, p50/p90/p99 %d/%d/%d cycles", TF_EOL,
+         st->name, st->cnt, st->min, st->avg, st->max, st->p50, st->p90, st->p99));
+  if (TS_Freq != 0U) {
+    PRINT(("%s    min/avg/max %d/%d/%d, p50/p90/p99 %d/%d/%d ns", TF_EOL,
+           tr_Ns (st->min), tr_Ns (st->avg), tr_Ns (st->max),
+           tr_Ns (st->p50), tr_Ns (st->p90), tr_Ns (st->p99)));
+  }
+#endif
+  FLUSH();
+}
+
+/*-----------------------------------------------------------------------------
+ * Print Test Report: Add test case benchmark value
+ *----------------------------------------------------------------------------*/
+static void TR_Print_Value (const char *name, uint32_t value, const char *unit) {
+#if (PRINT_BINARY_REPORT == 1)
+  uint8_t  rec[255];
+  uint32_t n;
+
+  bin_u16 (&rec[0], TC_Num);
+  bin_u16 (&rec[2], 0U);
+  bin_u32 (&rec[4], value);
+  for (n = 8U; (n < (sizeof(rec) - 1U)) && (*name != '\0'); n++) {
+    rec[n] = (uint8_t)*name++;
+  }
+  rec[n++] = 0U;
+  for (; (n < sizeof(rec)) && (*unit != '\0'); n++) {
+    rec[n] = (uint8_t)*unit++;
+  }
+  bin_record (BIN_TC_VALUE, rec, n);
+#elif (PRINT_XML_REPORT == 1)
+  PRINT(("<value><name>%s</name><val>%d</val><unit>%s</unit></value>%s", name, value, unit, TF_EOL));
+#else
+  TC_Lines = 1U;
+  PRINT(("%s  %s: %d %s", TF_EOL, name, value, unit));
+#endif
+  FLUSH();
+}
+
 /*-----------------------------------------------------------------------------
  * Print Test Report: End test case description
  *----------------------------------------------------------------------------*/
 static void TR_Print_Close_TC (const char *res) {
-#if (PRINT_XML_REPORT == 1)
+#if (PRINT_BINARY_REPORT == 1)
+  uint8_t rec[18];
+
+  bin_u16 (&rec[0], TC_Num);
+  rec[2] = bin_res (res);
+  rec[3] = 0U;
+  bin_u32 (&rec[4],  bin_hash (TC_Name));
+  bin_u16 (&rec[8],  TC_Asserts->passed);
+  bin_u16 (&rec[10], TC_Asserts->failed);
+  bin_u16 (&rec[12], TC_Asserts->warnings);
+  bin_u32 (&rec[14], TC_Cycles);
+  if (TC_MemValid != 0U) {
+    uint8_t mem[16];
+
+    bin_u16 (&mem[0],  TC_Num);
+    bin_u16 (&mem[2],  0U);
+    bin_u32 (&mem[4],  TC_Mem.stack);
+    bin_u32 (&mem[8],  TC_Mem.tstack);
+    bin_u32 (&mem[12], TC_Mem.heap);
+    bin_record (BIN_TC_MEMORY, mem, sizeof(mem));
+  }
+  if (TC_Run.runs > 1U) {
+    uint8_t run[28];
+
+    bin_u16 (&run[0],  TC_Num);
+    bin_u16 (&run[2],  0U);
+    bin_u32 (&run[4],  TC_Run.runs);
+    bin_u32 (&run[8],  TC_Run.failed);
+    bin_u32 (&run[12], TC_Run.min);
+    bin_u32 (&run[16], TC_Run.mean);
+    bin_u32 (&run[20], TC_Run.max);
+    bin_u32 (&run[24], TC_Run.dev);
+    bin_record (BIN_TC_REPEAT, run, sizeof(run));
+  }
+  bin_record (BIN_TC_CLOSE, rec, sizeof(rec));
+#elif (PRINT_XML_REPORT == 1)
+  char buf[24];
+
   PRINT(("</dbgi>%s", TF_EOL));
+  if (TS_Counter != NULL) {
+    PRINT(("<time>%s</time>%s", tr_Time (TC_Cycles, buf), TF_EOL));
+  }
+  if (TC_MemValid != 0U) {
+    PRINT(("<stack>%d</stack>%s",   TC_Mem.stack,  TF_EOL));
+    PRINT(("<tstack>%d</tstack>%s", TC_Mem.tstack, TF_EOL));
+    if (TC_Mem.heap_size != 0U) {
+      PRINT(("<heap>%d</heap>%s",   TC_Mem.heap,   TF_EOL));
+    }
+  }
+  if (TC_Run.runs > 1U) {
+    PRINT(("<runs>%d</runs>%s",   TC_Run.runs,   TF_EOL));
+    PRINT(("<rfail>%d</rfail>%s", TC_Run.failed, TF_EOL));
+    if (TS_Counter != NULL) {
+      PRINT(("<tmin>%s</tmin>%s",  tr_Time (TC_Run.min,  buf), TF_EOL));
+      PRINT(("<tmean>%s</tmean>%s", tr_Time (TC_Run.mean, buf), TF_EOL));
+      PRINT(("<tmax>%s</tmax>%s",  tr_Time (TC_Run.max,  buf), TF_EOL));
+      PRINT(("<tdev>%s</tdev>%s",  tr_Time (TC_Run.dev,  buf), TF_EOL));
+    }
+  }
   PRINT(("<res>%s</res>%s", res, TF_EOL));
   PRINT(("</tc>%s", TF_EOL));
 #else
-  if ((res == Passed) || (res == NotExe))
+  if ((TC_Lines != 0U) && ((res == Passed) || (res == NotExe) || (res == Timeout)))
+    PRINT(("%s  %s%s", TF_EOL, res, TF_EOL));
+  else if ((res == Passed) || (res == NotExe) || (res == Timeout))
     PRINT(("%s%s", res, TF_EOL));
   else
     PRINT(("%s", TF_EOL));
+
+  if (TC_Run.runs > 1U) {
+    char buf[4][24];
+
+    PRINT(("  Runs: %d, %d Failed", TC_Run.runs, TC_Run.failed));
+    if (TS_Counter != NULL) {
+      PRINT((", Time min/mean/max/dev: %s/%s/%s/%s s",
+             tr_Time (TC_Run.min,  buf[0]),
+             tr_Time (TC_Run.mean, buf[1]),
+             tr_Time (TC_Run.max,  buf[2]),
+             tr_Time (TC_Run.dev,  buf[3])));
+    }
+    PRINT(("%s", TF_EOL));
+  }
 #endif
   FLUSH();
 }
@@ -157,7 +543,33 @@ static void TR_Print_Close_TC (const char *res) {
  * Print Test Report: Output test report header
  *----------------------------------------------------------------------------*/
 static void TR_Print_Open (const char *title, const char *date, const char *time, const char *fn) {
-#if (PRINT_XML_REPORT == 1)
+#if (PRINT_BINARY_REPORT == 1)
+  uint8_t  rec[255];
+  uint32_t n, id;
+  const char *name;
+
+  (void)date;
+  (void)time;
+  (void)fn;
+  rec[0] = BIN_VERSION;
+  bin_u32 (&rec[1], TS_Freq);
+  for (n = 5U; (n < sizeof(rec)) && (*title != '\0'); n++) {
+    rec[n] = (uint8_t)*title++;
+  }
+  bin_record (BIN_REPORT_OPEN, rec, n);
+
+  /* File identifier to name table */
+  for (id = 0U; id < TF_NumFiles; id++) {
+    name = TF_Files[id];
+    bin_u16 (&rec[0], id);
+    for (n = 2U; (n < sizeof(rec)) && (*name != '\0'); n++) {
+      rec[n] = (uint8_t)*name++;
+    }
+    bin_record (BIN_FILE_NAME, rec, n);
+  }
+#elif (PRINT_XML_REPORT == 1)
+  uint32_t id;
+
   PRINT(("<?xml version=\"1.0\"?>%s", TF_EOL));
   PRINT(("<?xml-stylesheet href=\"TR_Style.xsl\" type=\"text/xsl\" ?>%s", TF_EOL));
   PRINT(("<report>%s", TF_EOL));
@@ -166,6 +578,14 @@ static void TR_Print_Open (const char *title, const char *date, const char *time
   PRINT(("<date>%s</date>%s",   date,  TF_EOL));
   PRINT(("<time>%s</time>%s",   time,  TF_EOL));
   PRINT(("<file>%s</file>%s",   fn,    TF_EOL));
+  if (TF_NumFiles != 0U) {
+    /* File identifier to name table */
+    PRINT(("<modules>%s", TF_EOL));
+    for (id = 0U; id < TF_NumFiles; id++) {
+      PRINT(("<mod><id>%d</id><name>%s</name></mod>%s", id, TF_Files[id], TF_EOL));
+    }
+    PRINT(("</modules>%s", TF_EOL));
+  }
   PRINT(("<test_cases>%s", TF_EOL));
 #else
   (void)fn;
@@ -178,7 +598,31 @@ static void TR_Print_Open (const char *title, const char *date, const char *time
  * Print Test Report: Output test report summary
  *----------------------------------------------------------------------------*/
 static void TR_Print_Close (void) {
-#if (PRINT_XML_REPORT == 1)
+#if (PRINT_BINARY_REPORT == 1)
+  uint8_t rec[24];
+
+  bin_u16 (&rec[0],  TestReport.tests);
+  bin_u16 (&rec[2],  TestReport.executed);
+  bin_u16 (&rec[4],  TestReport.passed);
+  bin_u16 (&rec[6],  TestReport.failed);
+  bin_u16 (&rec[8],  TestReport.warnings);
+  bin_u16 (&rec[10], 0U);
+  bin_u32 (&rec[12], TestReport.dropped);
+  bin_u32 (&rec[16], (uint32_t)(TestReport.cycles));
+  bin_u32 (&rec[20], (uint32_t)(TestReport.cycles >> 32));
+  if ((TestReport.memory.stack != 0U) || (TestReport.memory.tstack != 0U) || (TestReport.memory.heap_size != 0U)) {
+    uint8_t mem[16];
+
+    bin_u32 (&mem[0],  TestReport.memory.stack);
+    bin_u32 (&mem[4],  TestReport.memory.tstack);
+    bin_u32 (&mem[8],  TestReport.memory.heap);
+    bin_u32 (&mem[12], TestReport.memory.heap_size);
+    bin_record (BIN_REPORT_MEMORY, mem, sizeof(mem));
+  }
+  bin_record (BIN_REPORT_CLOSE, rec, sizeof(rec));
+#elif (PRINT_XML_REPORT == 1)
+  char buf[24];
+
   PRINT(("</test_cases>%s", TF_EOL));
   PRINT(("<summary>%s", TF_EOL));
   PRINT(("<tcnt>%d</tcnt>%s", TestReport.tests,    TF_EOL));
@@ -186,11 +630,27 @@ static void TR_Print_Close (void) {
   PRINT(("<pass>%d</pass>%s", TestReport.passed,   TF_EOL));
   PRINT(("<fail>%d</fail>%s", TestReport.failed,   TF_EOL));
   PRINT(("<warn>%d</warn>%s", TestReport.warnings, TF_EOL));
+  if (TS_Counter != NULL) {
+    PRINT(("<time>%s</time>%s", tr_Time (TestReport.cycles, buf), TF_EOL));
+  }
+  if ((TestReport.memory.stack != 0U) || (TestReport.memory.tstack != 0U) || (TestReport.memory.heap_size != 0U)) {
+    PRINT(("<stack>%d</stack>%s",   TestReport.memory.stack,  TF_EOL));
+    PRINT(("<tstack>%d</tstack>%s", TestReport.memory.tstack, TF_EOL));
+    if (TestReport.memory.heap_size != 0U) {
+      PRINT(("<heap>%d</heap>%s",         TestReport.memory.heap,      TF_EOL));
+      PRINT(("<heapsize>%d</heapsize>%s", TestReport.memory.heap_size, TF_EOL));
+    }
+  }
+#if (TF_OUTPUT_DEFERRED != 0)
+  PRINT(("<drop>%d</drop>%s", TestReport.dropped,  TF_EOL));
+#endif
   PRINT(("<tres>%s</tres>%s", tr_Eval(),            TF_EOL));
   PRINT(("</summary>%s", TF_EOL));
   PRINT(("</test>%s", TF_EOL));
   PRINT(("</report>%s", TF_EOL));
 #else
+  char buf[24];
+
   PRINT(("\nTest Summary: %d Tests, %d Executed, %d Passed, %d Failed, %d Warnings.%s",
          TestReport.tests,
          TestReport.executed,
@@ -198,27 +658,275 @@ static void TR_Print_Close (void) {
          TestReport.failed,
          TestReport.warnings,
          TF_EOL));
+  if (TS_Counter != NULL) {
+    PRINT(("Test Time: %s s%s", tr_Time (TestReport.cycles, buf), TF_EOL));
+  }
+  if ((TestReport.memory.stack != 0U) || (TestReport.memory.tstack != 0U) || (TestReport.memory.heap_size != 0U)) {
+    if (TestReport.memory.heap_size != 0U) {
+      PRINT(("Test Memory: %d bytes stack, %d bytes helper stack at test end, %d of %d bytes heap peak.%s",
+             TestReport.memory.stack,
+             TestReport.memory.tstack,
+             TestReport.memory.heap,
+             TestReport.memory.heap_size,
+             TF_EOL));
+    } else {
+      PRINT(("Test Memory: %d bytes stack, %d bytes helper stack at test end.%s",
+             TestReport.memory.stack,
+             TestReport.memory.tstack,
+             TF_EOL));
+    }
+  }
+  if (TestReport.dropped != 0U) {
+    PRINT(("Test Output: %d records dropped.%s", TestReport.dropped, TF_EOL));
+  }
   PRINT(("Test Result: %s%s", tr_Eval(), TF_EOL));
 #endif
   FLUSH();
 }
 
+/*-----------------------------------------------------------------------------
+ *       stdout_write:  Write a block of characters to the standard output
+ *                      (override for a bulk transfer capable output channel)
+ *----------------------------------------------------------------------------*/
+__WEAK int stdout_write (const char *buf, uint32_t len) {
 #if (TF_OUTPUT == 0)
+  len = (uint32_t)fwrite(buf, 1U, len, stdout);
+  fflush(stdout);
+#else
+  uint32_t n;
+
+  for (n = 0U; n < len; n++) {
+    if (stdout_putchar(buf[n]) < 0) {
+      return (-1);
+    }
+  }
+#endif
+  return ((int)len);
+}
+
+#if (TF_OUTPUT_DEFERRED != 0)
+/*-----------------------------------------------------------------------------
+ *       stdout_notify:  Signal that a deferred output record was published
+ *                       (override to wake up the logger thread)
+ *----------------------------------------------------------------------------*/
+__WEAK void stdout_notify (void) {
+}
+
+/*-----------------------------------------------------------------------------
+ *       stdout_wait:  Wait until deferred output was written
+ *                     (override to block until the logger thread made space)
+ *                     return 0 when output was written, -1 when unable to wait
+ *----------------------------------------------------------------------------*/
+__WEAK int stdout_wait (void) {
+#if (TF_OUTPUT_DEFERRED == 1)
+  /* Write published records synchronously */
+  TReport_Drain();
+  return (0);
+#else
+  return (-1);
+#endif
+}
+#endif
+
+#if (TF_OUTPUT_DEFERRED == 0)
+/*-----------------------------------------------------------------------------
+ *       out_flush:  Write buffered characters to the standard output
+ *----------------------------------------------------------------------------*/
+static void out_flush (void) {
+  if (OutCnt != 0U) {
+    stdout_write(OutBuf, OutCnt);
+    OutCnt = 0U;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ *       out_putchar:  Put a character into the output buffer
+ *----------------------------------------------------------------------------*/
+static int out_putchar (int ch) {
+  OutBuf[OutCnt++] = (char)ch;
+
+#if (TF_OUTPUT_FLUSH == 1)
+  if ((OutCnt == TF_OUTPUT_BUF_SIZE) || (ch == '\n')) {
+#else
+  if (OutCnt == TF_OUTPUT_BUF_SIZE) {
+#endif
+    out_flush();
+  }
+  return (ch);
+}
+
+#else
+/*-----------------------------------------------------------------------------
+ *       out_flush:  Publish the current record to the output ring buffer
+ *----------------------------------------------------------------------------*/
+static void out_flush (void) {
+  if (RecDrop != 0U) {
+    /* Discard incomplete record */
+    RecHead = RingHead;
+    RecDrop = 0U;
+    TestReport.dropped++;
+  } else {
+    /* Record data must be visible before the new head */
+    __DMB();
+    RingHead = RecHead;
+    stdout_notify();
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ *       out_putchar:  Put a character into the output ring buffer
+ *----------------------------------------------------------------------------*/
+static int out_putchar (int ch) {
+  if (RecDrop == 0U) {
+    /* Ring buffer full: wait until published records are written */
+    while ((RecHead - RingTail) >= TF_OUTPUT_RING_SIZE) {
+      if ((RecHead - RingHead) >= TF_OUTPUT_RING_SIZE) {
+        /* Record larger than the ring buffer: publish it in parts */
+        __DMB();
+        RingHead = RecHead;
+      }
+      if (stdout_wait() != 0) {
+        /* Unable to wait (interrupt or kernel not running) */
+        RecDrop = 1U;
+        return (ch);
+      }
+    }
+    RingBuf[RecHead & (TF_OUTPUT_RING_SIZE - 1U)] = (char)ch;
+    RecHead++;
+  }
+  return (ch);
+}
+#endif
+
+#if (PRINT_BINARY_REPORT == 1)
+  /* Formatted print is not used by the binary report */
+#elif (TF_OUTPUT == 0)
+/*-----------------------------------------------------------------------------
+ *       print_long:  Print a message that does not fit into the print buffer
+ *                    (format one conversion at a time into the buffer)
+ *----------------------------------------------------------------------------*/
+static void print_long (char *buf, uint32_t size, const char *msg, va_list *args) {
+  char fmt[32];
+  const char *str;
+  uint32_t n;
+  int len, i;
+  char conv;
+
+  while (*msg != '\0') {
+    if (*msg != '%') {
+      out_putchar(*msg++);
+      continue;
+    }
+    /* Copy conversion specification, expand '*' width and precision */
+    n = 0U;
+    fmt[n++] = *msg++;
+    while ((*msg != '\0') && (strchr("diouxXcspfFeEgGaA%", *msg) == NULL) && (n < (sizeof(fmt) - 16U))) {
+      if (*msg == '*') {
+        i = va_arg(*args, int);
+        if ((i < 0) && (fmt[n - 1U] == '.')) {
+          /* Negative precision is taken as if omitted */
+          n--;
+        } else {
+          n += (uint32_t)snprintf(&fmt[n], sizeof(fmt) - n, "%d", i);
+        }
+      } else {
+        fmt[n++] = *msg;
+      }
+      msg++;
+    }
+    conv = *msg;
+    if ((conv == '\0') || (strchr("diouxXcspfFeEgGaA%", conv) == NULL)) {
+      /* Invalid conversion specification */
+      break;
+    }
+    msg++;
+    fmt[n++] = conv;
+    fmt[n]   = '\0';
+
+    /* Fetch the argument with the type selected by the length modifier */
+    switch (conv) {
+      case '%':
+        len = snprintf(buf, size, "%%");
+        break;
+      case 's':
+        str = va_arg(*args, const char *);
+        if (n == 2U) {
+          /* Plain string: write it directly */
+          while (*str != '\0') {
+            out_putchar(*str++);
+          }
+          len = 0;
+        } else {
+          len = snprintf(buf, size, fmt, str);
+        }
+        break;
+      case 'p':
+        len = snprintf(buf, size, fmt, va_arg(*args, void *));
+        break;
+      case 'f': case 'F': case 'e': case 'E':
+      case 'g': case 'G': case 'a': case 'A':
+        if (fmt[n - 2U] == 'L') {
+          len = snprintf(buf, size, fmt, va_arg(*args, long double));
+        } else {
+          len = snprintf(buf, size, fmt, va_arg(*args, double));
+        }
+        break;
+      default:
+        switch (fmt[n - 2U]) {
+          case 'l':
+            if (fmt[n - 3U] == 'l') {
+              len = snprintf(buf, size, fmt, va_arg(*args, long long));
+            } else {
+              len = snprintf(buf, size, fmt, va_arg(*args, long));
+            }
+            break;
+          case 'j':
+            len = snprintf(buf, size, fmt, va_arg(*args, intmax_t));
+            break;
+          case 'z':
+            len = snprintf(buf, size, fmt, va_arg(*args, size_t));
+            break;
+          case 't':
+            len = snprintf(buf, size, fmt, va_arg(*args, ptrdiff_t));
+            break;
+          default:
+            /* char and short arguments are promoted to int */
+            len = snprintf(buf, size, fmt, va_arg(*args, int));
+            break;
+        }
+        break;
+    }
+    if (len > (int)(size - 1U)) {
+      len = (int)(size - 1U);
+    }
+    for (i = 0; i < len; i++) {
+      out_putchar(buf[i]);
+    }
+  }
+}
+
 /*-----------------------------------------------------------------------------
  *       print_stdio:  Print a message to the standard output
  *----------------------------------------------------------------------------*/
 void print_stdio (const char *msg, ...) {
+  static char buf[512];
   va_list args;
+  int len, i;
+
   va_start(args, msg);
-  vprintf(msg, args);
+  len = vsnprintf(buf, sizeof(buf), msg, args);
   va_end(args);
-}
 
-/*-----------------------------------------------------------------------------
- *       flush_stdio:  Flush the standard output
- *----------------------------------------------------------------------------*/
-void flush_stdio (void) {
-  fflush(stdout);
+  if (len > (int)(sizeof(buf) - 1U)) {
+    /* Message does not fit: write it one conversion at a time */
+    va_start(args, msg);
+    print_long(buf, sizeof(buf), msg, &args);
+    va_end(args);
+    return;
+  }
+  for (i = 0; i < len; i++) {
+    out_putchar(buf[i]);
+  }
 }
 
 #elif (TF_OUTPUT == 1)
@@ -450,10 +1158,6 @@ static int printf_lim (const char *fmt, ...) {
 
   return len;
 }
-
-static int out_putchar (int ch) {
-  return stdout_putchar(ch);
-}
 #endif /* TF_OUTPUT */
 
 /*-----------------------------------------------------------------------------
@@ -473,6 +1177,7 @@ static const char *fn_strip (const char *fn) {
   return (p);
 }
 
+#if (PRINT_BINARY_REPORT == 0)
 /*-----------------------------------------------------------------------------
  * Evaluate test report results and return result string
  *----------------------------------------------------------------------------*/
@@ -497,12 +1202,18 @@ static const char *tr_Eval (void) {
 }
 
 
+#endif
+
 /*-----------------------------------------------------------------------------
  * Evaluate test case results and return result string
  *----------------------------------------------------------------------------*/
 static const char *tc_Eval (void) {
 
-  if (TC_Asserts->failed > 0) {
+  if (TC_Timeout != 0U) {
+    /* Test case did not complete within its time budget */
+    return Timeout;
+  }
+  else if (TC_Asserts->failed > 0) {
     /* Test case fails if any failed assertion recorded */
     return Failed;
   }
@@ -520,6 +1231,131 @@ static const char *tc_Eval (void) {
   }
 }
 
+/*-----------------------------------------------------------------------------
+ * Integer square root
+ *----------------------------------------------------------------------------*/
+static uint32_t tr_Sqrt (uint64_t val) {
+  uint64_t res, bit;
+
+  res = 0U;
+  bit = 1ULL << 62;
+  while (bit > val) {
+    bit >>= 2;
+  }
+  while (bit != 0U) {
+    if (val >= (res + bit)) {
+      val -= res + bit;
+      res  = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return ((uint32_t)res);
+}
+
+#if (PRINT_BINARY_REPORT == 0)
+/*-----------------------------------------------------------------------------
+ * Convert timestamp cycles to nanoseconds
+ *----------------------------------------------------------------------------*/
+static uint32_t tr_Ns (uint32_t cycles) {
+
+  if (TS_Freq == 0U) {
+    return (0U);
+  }
+  return ((uint32_t)(((uint64_t)cycles * 1000000000U) / TS_Freq));
+}
+
+/*-----------------------------------------------------------------------------
+ * Convert timestamp cycles to seconds string with microsecond resolution
+ *----------------------------------------------------------------------------*/
+static const char *tr_Time (uint64_t cycles, char *buf) {
+  uint64_t sec;
+  uint32_t usec;
+  char     tmp[21];
+  int      i, n;
+
+  if (TS_Freq == 0U) {
+    /* Unknown frequency: report zero time */
+    sec  = 0U;
+    usec = 0U;
+  } else {
+    sec  = cycles / TS_Freq;
+    usec = (uint32_t)(((cycles % TS_Freq) * 1000000U) / TS_Freq);
+  }
+
+  /* Integer part in reverse order */
+  n = 0;
+  do {
+    tmp[n++] = (char)(sec % 10U) + '0';
+    sec /= 10U;
+  } while (sec > 0U);
+
+  i = 0;
+  while (n > 0) {
+    buf[i++] = tmp[--n];
+  }
+
+  /* Fraction part, zero padded to 6 digits */
+  buf[i++] = '.';
+  for (n = 5; n >= 0; n--) {
+    buf[i + n] = (char)(usec % 10U) + '0';
+    usec /= 10U;
+  }
+  buf[i + 6] = '\0';
+
+  return (buf);
+}
+#endif
+
+/*-----------------------------------------------------------------------------
+ * Write published deferred output records to the standard output
+ *----------------------------------------------------------------------------*/
+uint32_t TReport_Drain (void) {
+#if (TF_OUTPUT_DEFERRED != 0)
+  uint32_t tail, cnt, idx, len, num;
+
+  tail = RingTail;
+  cnt  = RingHead - tail;
+  num  = cnt;
+
+  /* Read record data only after the head */
+  __DMB();
+
+  while (cnt != 0U) {
+    /* Write contiguous part of the ring buffer */
+    idx = tail & (TF_OUTPUT_RING_SIZE - 1U);
+    len = TF_OUTPUT_RING_SIZE - idx;
+    if (len > cnt) {
+      len = cnt;
+    }
+    stdout_write(&RingBuf[idx], len);
+
+    tail += len;
+    cnt  -= len;
+
+    /* Release space to the producer */
+    __DMB();
+    RingTail = tail;
+  }
+
+  return (num);
+#else
+  return (0U);
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Get number of deferred output bytes pending to be written
+ *----------------------------------------------------------------------------*/
+uint32_t TReport_Pending (void) {
+#if (TF_OUTPUT_DEFERRED != 0)
+  return (RingHead - RingTail);
+#else
+  return (0U);
+#endif
+}
+
 /*-----------------------------------------------------------------------------
  * Initialize Test Report
  *----------------------------------------------------------------------------*/
@@ -532,6 +1368,14 @@ int32_t TReport_Init (void) {
   TestReport.passed    = 0U;
   TestReport.failed    = 0U;
   TestReport.warnings  = 0U;
+  TestReport.cycles    = 0U;
+  TestReport.dropped   = 0U;
+
+  /* Clear memory usage */
+  TestReport.memory.stack     = 0U;
+  TestReport.memory.tstack    = 0U;
+  TestReport.memory.heap      = 0U;
+  TestReport.memory.heap_size = 0U;
 
   /* Clear assert statistic */
   TR_Asserts->passed   = 0U;
@@ -548,6 +1392,28 @@ int32_t TReport_Init (void) {
   return (0);
 }
 
+/*-----------------------------------------------------------------------------
+ * Set test case timestamp counter
+ *----------------------------------------------------------------------------*/
+int32_t TReport_SetTimestamp (uint32_t (*timestamp)(void), uint32_t freq) {
+
+  TS_Counter = timestamp;
+  TS_Freq    = freq;
+
+  return (0);
+}
+
+/*-----------------------------------------------------------------------------
+ * Set test module file names used to resolve assertion file identifiers
+ *----------------------------------------------------------------------------*/
+int32_t TReport_SetFiles (const char * const *files, uint32_t num) {
+
+  TF_Files    = files;
+  TF_NumFiles = (files != NULL) ? num : 0U;
+
+  return (0);
+}
+
 /*-----------------------------------------------------------------------------
  * Open test report
  *----------------------------------------------------------------------------*/
@@ -567,15 +1433,43 @@ int32_t TReport_TestOpen (uint32_t num, const char *fn) {
   TC_Asserts->failed   = 0U;
   TC_Asserts->warnings = 0U;
 
+  TC_Num      = num;
+  TC_Name     = fn;
+  TC_Timeout  = 0U;
+  TC_MemValid = 0U;
+  TC_Lines    = 0U;
+
+  TC_Run.runs   = 0U;
+  TC_Run.failed = 0U;
+  TC_Run.min    = 0U;
+  TC_Run.max    = 0U;
+  TC_Run.mean   = 0U;
+  TC_Run.dev    = 0U;
+  TC_IterFailed = 0U;
+  TC_IterSum    = 0U;
+  TC_IterSd     = 0;
+  TC_IterSdd    = 0U;
+
   TR_Print_Open_TC (num, fn);
 
+#if (TF_OUTPUT_DEFERRED == 1)
+  /* Write deferred output at the test case boundary */
+  TReport_Drain();
+#endif
+
+  /* Start measuring after the test case header is printed */
+  if (TS_Counter != NULL) {
+    TS_Start = TS_Counter();
+    TS_Iter  = TS_Start;
+  }
+
   return (0);
 }
 
 /*-----------------------------------------------------------------------------
- * Add test case assert result to the Test Report
+ * Add assert result given by file name or file identifier (fn == NULL)
  *----------------------------------------------------------------------------*/
-int32_t TReport_TestAdd (const char *fn, uint32_t ln, char *desc, TC_RES res) {
+static void tc_Add (const char *fn, uint32_t id, uint32_t ln, char *desc, TC_RES res) {
 #if (BUFFER_ASSERTIONS != 0)
   uint32_t n;
 #endif
@@ -599,9 +1493,16 @@ int32_t TReport_TestAdd (const char *fn, uint32_t ln, char *desc, TC_RES res) {
   }
 
   /* Add debug info if assertion passed with warnings or failed */
-  if ((res == WARNING) || (res == FAILED)) {
-    /* Strip path information from the file name */
-    fn = fn_strip (fn);
+  /* (repeated test case: only until the first failed iteration) */
+  if (((res == WARNING) || (res == FAILED)) && (TC_Run.failed == 0U)) {
+    if (fn != NULL) {
+      /* Strip path information from the file name */
+      fn = fn_strip (fn);
+    } else if ((TF_Files != NULL) && (id < TF_NumFiles)) {
+      fn = TF_Files[id];
+    } else {
+      fn = "unknown";
+    }
 
     /* Get result string */
     p = tc_Eval();
@@ -617,18 +1518,136 @@ int32_t TReport_TestAdd (const char *fn, uint32_t ln, char *desc, TC_RES res) {
     }
     #endif
 
-    TR_Print_WriteDebug (fn, ln, desc, p);
+    TR_Print_WriteDebug (fn, id, ln, desc, p);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Add test case assert result to the Test Report
+ *----------------------------------------------------------------------------*/
+int32_t TReport_TestAdd (const char *fn, uint32_t ln, char *desc, TC_RES res) {
+
+  tc_Add (fn, TF_FILE_NONE, ln, desc, res);
+
+  return (0);
+}
+
+/*-----------------------------------------------------------------------------
+ * Add test case assert result given by packed file identifier and line
+ *----------------------------------------------------------------------------*/
+int32_t TReport_TestAddLoc (uint32_t loc, TC_RES res) {
+
+  tc_Add (NULL, TF_LOC_FILE(loc), TF_LOC_LINE(loc), NULL, res);
+
+  return (0);
+}
+
+/*-----------------------------------------------------------------------------
+ * Mark test case as timed out
+ *----------------------------------------------------------------------------*/
+int32_t TReport_TestTimeout (void) {
+
+  TC_Timeout = 1U;
+
+  return (0);
+}
+
+/*-----------------------------------------------------------------------------
+ * Set memory usage of the current test case
+ *----------------------------------------------------------------------------*/
+int32_t TReport_TestMemory (const MEM_STAT *mem) {
+
+  if (TC_MemValid == 0U) {
+    TC_Mem      = *mem;
+    TC_MemValid = 1U;
+  } else {
+    /* Repeated test case: keep peak usage of all iterations */
+    if (mem->stack  > TC_Mem.stack)  { TC_Mem.stack  = mem->stack;  }
+    if (mem->tstack > TC_Mem.tstack) { TC_Mem.tstack = mem->tstack; }
+    if (mem->heap   > TC_Mem.heap)   { TC_Mem.heap   = mem->heap;   }
+  }
+
+  /* Track peak usage over all test cases */
+  if (mem->stack     > TestReport.memory.stack)     { TestReport.memory.stack     = mem->stack;     }
+  if (mem->tstack    > TestReport.memory.tstack)    { TestReport.memory.tstack    = mem->tstack;    }
+  if (mem->heap      > TestReport.memory.heap)      { TestReport.memory.heap      = mem->heap;      }
+  if (mem->heap_size > TestReport.memory.heap_size) { TestReport.memory.heap_size = mem->heap_size; }
+
+  return (0);
+}
+
+/*-----------------------------------------------------------------------------
+ * Complete test case iteration: update pass/fail count and time statistics
+ *----------------------------------------------------------------------------*/
+int32_t TReport_TestIteration (void) {
+  uint32_t now, cycles;
+  int64_t  d;
+
+  TC_Run.runs++;
+  if ((TC_Asserts->failed != TC_IterFailed) || (TC_Timeout != 0U)) {
+    TC_Run.failed++;
+  }
+  TC_IterFailed = TC_Asserts->failed;
+
+  if (TS_Counter != NULL) {
+    now     = TS_Counter();
+    cycles  = now - TS_Iter;
+    TS_Iter = now;
+
+    if (TC_Run.runs == 1U) {
+      TC_Run.min   = cycles;
+      TC_Run.max   = cycles;
+      TC_IterFirst = cycles;
+    }
+    if (cycles < TC_Run.min) { TC_Run.min = cycles; }
+    if (cycles > TC_Run.max) { TC_Run.max = cycles; }
+
+    /* Accumulate deviations from the first iteration to keep the squares small */
+    d = (int64_t)cycles - (int64_t)TC_IterFirst;
+    TC_IterSum += cycles;
+    TC_IterSd  += d;
+    TC_IterSdd += (uint64_t)(d * d);
+
+    TC_Run.mean = (uint32_t)(TC_IterSum / TC_Run.runs);
+    d = TC_IterSd / (int64_t)TC_Run.runs;
+    TC_Run.dev  = tr_Sqrt ((TC_IterSdd / TC_Run.runs) - (uint64_t)(d * d));
   }
 
   return (0);
 }
 
+/*-----------------------------------------------------------------------------
+ * Add benchmark statistics to the current test case
+ *----------------------------------------------------------------------------*/
+int32_t TReport_TestBench (const BENCH_STAT *stat) {
+
+  TR_Print_Bench (stat);
+
+  return (0);
+}
+
+/*-----------------------------------------------------------------------------
+ * Add benchmark value to the current test case
+ *----------------------------------------------------------------------------*/
+int32_t TReport_TestValue (const char *name, uint32_t value, const char *unit) {
+
+  TR_Print_Value (name, value, unit);
+
+  return (0);
+}
+
 /*-----------------------------------------------------------------------------
  * Close test case
  *----------------------------------------------------------------------------*/
 int32_t TReport_TestClose (void) {
   const char *res;
 
+  /* Stop measuring before the test case result is printed */
+  if (TS_Counter != NULL) {
+    TC_Cycles = TS_Counter() - TS_Start;
+    TestReport.cycles += TC_Cycles;
+  }
+
   /* Increment test report test statistic */
   TestReport.tests++;
   TestReport.executed++;
@@ -641,7 +1660,7 @@ int32_t TReport_TestClose (void) {
   else if (res == Warning) {
     TestReport.warnings++;
   }
-  else if (res == Failed) {
+  else if ((res == Failed) || (res == Timeout)) {
     TestReport.failed++;
   }
   else {
@@ -662,6 +1681,11 @@ int32_t TReport_Close (void) {
 
   TR_Print_Close();
 
+#if (TF_OUTPUT_DEFERRED == 1)
+  /* Write remaining deferred output */
+  TReport_Drain();
+#endif
+
   return (0);
 }
 
@@ -683,3 +1707,13 @@ uint32_t __assert_true (const char *fn, uint32_t ln, uint32_t cond) {
 
   return (cond);
 }
+
+/*-----------------------------------------------------------------------------
+ * Assert true (packed file identifier and line number)
+ *----------------------------------------------------------------------------*/
+uint32_t __assert_loc (uint32_t loc, uint32_t cond) {
+
+  TReport_TestAddLoc (loc, (cond != 0U) ? PASSED : FAILED);
+
+  return (cond);
+}